@@ -43,6 +43,175 @@
 #define LIBSEE_LOG_EVERYTHING 0
 #endif
 
+/*
+ *  Every N-th call to `qsort` and `qsort_s` is sampled for presortedness, running the user-supplied
+ *  comparator over up to `LIBSEE_QSORT_SAMPLED_PAIRS` adjacent pairs of elements before the sort starts.
+ *  The sampling itself isn't included into the reported `qsort` cycles.
+ */
+#if !defined(LIBSEE_QSORT_SAMPLING_PERIOD) || LIBSEE_QSORT_SAMPLING_PERIOD <= 0
+#define LIBSEE_QSORT_SAMPLING_PERIOD 16
+#endif
+#if !defined(LIBSEE_QSORT_SAMPLED_PAIRS) || LIBSEE_QSORT_SAMPLED_PAIRS <= 0
+#define LIBSEE_QSORT_SAMPLED_PAIRS 1024
+#endif
+
+/*
+ *  Some functions are also attributed to the call sites and the threads they were called from.
+ *  Both tables have a fixed capacity, and the calls that don't fit are only reflected in the main report.
+ *  Only the most expensive `LIBSEE_MAX_REPORTED_CALL_SITES` entries of each table are printed.
+ */
+#if !defined(LIBSEE_MAX_CALL_SITES) || LIBSEE_MAX_CALL_SITES <= 0
+#define LIBSEE_MAX_CALL_SITES 1024
+#endif
+#if !defined(LIBSEE_MAX_REPORTED_CALL_SITES) || LIBSEE_MAX_REPORTED_CALL_SITES <= 0
+#define LIBSEE_MAX_REPORTED_CALL_SITES 16
+#endif
+
+/*
+ *  All of those tables use linear probing, capped at `LIBSEE_MAX_PROBES` slots, so that a full table
+ *  doesn't turn every call into a scan. The updates, that found no slot, are counted in the report.
+ */
+#if !defined(LIBSEE_MAX_PROBES) || LIBSEE_MAX_PROBES <= 0
+#define LIBSEE_MAX_PROBES 32
+#endif
+
+/*
+ *  Functions taking process-wide locks, like `setlocale`, are flagged as scaling hazards
+ *  if they are called more than this many times within a single second.
+ */
+#if !defined(LIBSEE_LOCALE_CALLS_PER_SECOND) || LIBSEE_LOCALE_CALLS_PER_SECOND <= 0
+#define LIBSEE_LOCALE_CALLS_PER_SECOND 1000
+#endif
+
+/*
+ *  Random number generators with a process-wide state, like `rand`, are flagged as contention
+ *  hotspots if they are called from at least this many threads.
+ */
+#if !defined(LIBSEE_CONTENDED_THREADS) || LIBSEE_CONTENDED_THREADS <= 0
+#define LIBSEE_CONTENDED_THREADS 4
+#endif
+
+/*
+ *  Character-level and line-level I/O is attributed to individual `FILE` streams,
+ *  distinguishing the locking functions from their `_unlocked` counterparts.
+ */
+#if !defined(LIBSEE_MAX_STREAMS) || LIBSEE_MAX_STREAMS <= 0
+#define LIBSEE_MAX_STREAMS 256
+#endif
+
+/*
+ *  Stream I/O is also attributed to the opened files, with the paths truncated to a fixed length.
+ */
+#if !defined(LIBSEE_MAX_PATHS) || LIBSEE_MAX_PATHS <= 0
+#define LIBSEE_MAX_PATHS 256
+#endif
+#if !defined(LIBSEE_MAX_PATH_LENGTH) || LIBSEE_MAX_PATH_LENGTH <= 4
+#define LIBSEE_MAX_PATH_LENGTH 128
+#endif
+
+/*
+ *  Socket traffic is attributed to file descriptors below this limit, which are used as direct indices.
+ */
+#if !defined(LIBSEE_MAX_DESCRIPTORS) || LIBSEE_MAX_DESCRIPTORS <= 0
+#define LIBSEE_MAX_DESCRIPTORS 1024
+#endif
+
+/*
+ *  Regular expressions and other patterns are keyed by their text, truncated to a fixed length.
+ *  The same limit applies to the number of compiled `regex_t` objects alive at the same time.
+ */
+#if !defined(LIBSEE_MAX_PATTERNS) || LIBSEE_MAX_PATTERNS <= 0
+#define LIBSEE_MAX_PATTERNS 256
+#endif
+#if !defined(LIBSEE_MAX_PATTERN_LENGTH) || LIBSEE_MAX_PATTERN_LENGTH <= 4
+#define LIBSEE_MAX_PATTERN_LENGTH 64
+#endif
+
+/*
+ *  PCRE2 is intercepted only when this is set, as exporting its symbols from a library, that can't find
+ *  the originals, would crash the programs loading PCRE2 lazily. The build system compiles a separate
+ *  `libsee_pcre2` library with this flag, if the PCRE2 headers are found.
+ */
+#if !defined(LIBSEE_PCRE2)
+#define LIBSEE_PCRE2 0
+#endif
+
+/*
+ *  BLAS and LAPACK are intercepted only when this is set, for the same reason, in a separate `libsee_blas` library.
+ *  The calls are aggregated by the routine and the dimensions, rounded up to powers of two.
+ */
+#if !defined(LIBSEE_BLAS)
+#define LIBSEE_BLAS 0
+#endif
+#if !defined(LIBSEE_MAX_BLAS_SHAPES) || LIBSEE_MAX_BLAS_SHAPES <= 0
+#define LIBSEE_MAX_BLAS_SHAPES 256
+#endif
+
+/*
+ *  zlib is intercepted only when this is set, in a separate `libsee_zlib` library, attributing the streams
+ *  to the call sites in a separate table.
+ */
+#if !defined(LIBSEE_ZLIB)
+#define LIBSEE_ZLIB 0
+#endif
+#if !defined(LIBSEE_MAX_ZLIB_SITES) || LIBSEE_MAX_ZLIB_SITES <= 0
+#define LIBSEE_MAX_ZLIB_SITES 256
+#endif
+
+/*
+ *  Process creation is attributed to call sites in a separate table, to compare `fork` against `posix_spawn`.
+ */
+#if !defined(LIBSEE_MAX_SPAWN_SITES) || LIBSEE_MAX_SPAWN_SITES <= 0
+#define LIBSEE_MAX_SPAWN_SITES 256
+#endif
+
+/*
+ *  Libraries loaded with `dlopen` are aggregated by their paths.
+ */
+#if !defined(LIBSEE_MAX_LIBRARIES) || LIBSEE_MAX_LIBRARIES <= 0
+#define LIBSEE_MAX_LIBRARIES 256
+#endif
+
+/*
+ *  Filesystem metadata calls are aggregated by the first few directories of their paths, and the same path
+ *  queried again within a short window is counted as a repeated lookup, that the program could have cached.
+ */
+#if !defined(LIBSEE_PATH_PREFIX_DEPTH) || LIBSEE_PATH_PREFIX_DEPTH <= 0
+#define LIBSEE_PATH_PREFIX_DEPTH 3
+#endif
+#if !defined(LIBSEE_MAX_PATH_PREFIXES) || LIBSEE_MAX_PATH_PREFIXES <= 0
+#define LIBSEE_MAX_PATH_PREFIXES 256
+#endif
+#if !defined(LIBSEE_MAX_RECENT_STATS) || LIBSEE_MAX_RECENT_STATS <= 0
+#define LIBSEE_MAX_RECENT_STATS 1024
+#endif
+#if !defined(LIBSEE_REPEATED_STAT_MILLISECONDS) || LIBSEE_REPEATED_STAT_MILLISECONDS <= 0
+#define LIBSEE_REPEATED_STAT_MILLISECONDS 100
+#endif
+
+/*
+ *  Environment lookups are aggregated by the variable name, and separately by the name and the call site.
+ */
+#if !defined(LIBSEE_MAX_ENVIRONMENT_VARIABLES) || LIBSEE_MAX_ENVIRONMENT_VARIABLES <= 0
+#define LIBSEE_MAX_ENVIRONMENT_VARIABLES 256
+#endif
+
+/*
+ *  Name resolution and NSS lookups are aggregated by the function and the queried name, each with its own
+ *  latency histogram, so the capacity is kept lower than for the call sites.
+ */
+#if !defined(LIBSEE_MAX_RESOLVED_NAMES) || LIBSEE_MAX_RESOLVED_NAMES <= 0
+#define LIBSEE_MAX_RESOLVED_NAMES 128
+#endif
+
+/*
+ *  Clocks costing more than this many cycles per `clock_gettime` call are flagged as likely
+ *  falling back from the vDSO to a system call, usually because of an unstable clock source.
+ */
+#if !defined(LIBSEE_VDSO_MAX_CYCLES) || LIBSEE_VDSO_MAX_CYCLES <= 0
+#define LIBSEE_VDSO_MAX_CYCLES 500
+#endif
+
 /*
  *  The issue here is that RTLD_NEXT is not defined by the posix standard.
  *  So the GNU people don't enable it unless you #define _GNU_SOURCE or -D_GNU_SOURCE.
@@ -61,6 +230,10 @@
 
 #include <dlfcn.h> // `RTLD_NEXT`
 
+#include <pthread.h>     // `pthread_self`
+#include <sys/syscall.h> // `SYS_gettid`
+#include <unistd.h>      // `syscall`
+
 #include <errno.h>  // `errno_t`
 #include <stddef.h> // `rsize_t`
 
@@ -69,7 +242,7 @@ typedef int errno_t;
 typedef size_t rsize_t;
 #endif
 
-#define LIBSEE_MAX_SYMBOLS 97
+#define LIBSEE_MAX_SYMBOLS 375
 
 /**
  *  @brief  Contains the number of times each function was called.
@@ -119,6 +292,34 @@ typedef union thread_local_counters {
         size_t wcswidth;
         size_t wcwidth;
 
+        size_t wcslen;
+        size_t wcsnlen;
+        size_t wcscmp;
+        size_t wcsncmp;
+        size_t wcscpy;
+        size_t wcsncpy;
+        size_t wcscat;
+        size_t wcschr;
+        size_t wcsrchr;
+        size_t wcsstr;
+        size_t wcstok;
+        size_t wmemcpy;
+        size_t wmemmove;
+        size_t wmemset;
+        size_t wmemcmp;
+        size_t wmemchr;
+        size_t wcscoll;
+        size_t wcsxfrm;
+
+        size_t mbrtowc;
+        size_t mbstowcs;
+        size_t wcrtomb;
+        size_t wcsrtombs;
+        size_t mbrlen;
+        size_t mbsrtowcs;
+        size_t btowc;
+        size_t iconv;
+
         size_t malloc;
         size_t calloc;
         size_t realloc;
@@ -130,9 +331,163 @@ typedef union thread_local_counters {
         size_t bsearch;
         size_t bsearch_s;
 
+        size_t hcreate;
+        size_t hsearch;
+        size_t hdestroy;
+        size_t hcreate_r;
+        size_t hsearch_r;
+        size_t hdestroy_r;
+        size_t tsearch;
+        size_t tfind;
+        size_t tdelete;
+        size_t twalk;
+        size_t lsearch;
+        size_t lfind;
+
+        size_t regcomp;
+        size_t regexec;
+        size_t regerror;
+        size_t regfree;
+        size_t fnmatch;
+        size_t glob;
+        size_t globfree;
+        size_t wordexp;
+        size_t wordfree;
+
+        size_t pcre2_compile_8;
+        size_t pcre2_code_free_8;
+        size_t pcre2_jit_compile_8;
+        size_t pcre2_match_8;
+        size_t pcre2_jit_match_8;
+        size_t pcre2_match_data_create_8;
+        size_t pcre2_match_data_create_from_pattern_8;
+        size_t pcre2_match_data_free_8;
+
+        size_t cblas_sgemm;
+        size_t cblas_dgemm;
+        size_t cblas_sgemv;
+        size_t cblas_dgemv;
+        size_t cblas_saxpy;
+        size_t cblas_daxpy;
+        size_t cblas_sdot;
+        size_t cblas_ddot;
+        size_t sgemm_;
+        size_t dgemm_;
+        size_t sgemv_;
+        size_t dgemv_;
+        size_t saxpy_;
+        size_t daxpy_;
+        size_t sdot_;
+        size_t ddot_;
+
+        size_t sgesv_;
+        size_t dgesv_;
+        size_t sgetrf_;
+        size_t dgetrf_;
+        size_t spotrf_;
+        size_t dpotrf_;
+        size_t sgeqrf_;
+        size_t dgeqrf_;
+        size_t ssyev_;
+        size_t dsyev_;
+        size_t sgesdd_;
+        size_t dgesdd_;
+
+        size_t deflateInit_;
+        size_t deflateInit2_;
+        size_t deflate;
+        size_t deflateReset;
+        size_t deflateEnd;
+        size_t inflateInit_;
+        size_t inflateInit2_;
+        size_t inflate;
+        size_t inflateReset;
+        size_t inflateEnd;
+        size_t compress2;
+        size_t uncompress;
+        size_t crc32;
+        size_t adler32;
+
         size_t srand;
         size_t rand;
 
+        size_t random;
+        size_t srandom;
+        size_t rand_r;
+        size_t random_r;
+        size_t drand48;
+        size_t erand48;
+        size_t lrand48;
+        size_t nrand48;
+        size_t mrand48;
+        size_t jrand48;
+        size_t srand48;
+        size_t seed48;
+        size_t lcong48;
+        size_t arc4random;
+        size_t arc4random_buf;
+        size_t arc4random_uniform;
+        size_t getrandom;
+        size_t exp;
+        size_t expf;
+        size_t expl;
+        size_t log;
+        size_t logf;
+        size_t logl;
+        size_t pow;
+        size_t powf;
+        size_t powl;
+        size_t sin;
+        size_t sinf;
+        size_t sinl;
+        size_t cos;
+        size_t cosf;
+        size_t cosl;
+        size_t sqrt;
+        size_t sqrtf;
+        size_t sqrtl;
+        size_t fmod;
+        size_t fmodf;
+        size_t fmodl;
+        size_t erf;
+        size_t erff;
+        size_t erfl;
+        size_t lgamma;
+        size_t lgammaf;
+        size_t lgammal;
+
+        size_t strtol;
+        size_t strtoll;
+        size_t strtoul;
+        size_t strtoull;
+        size_t strtoimax;
+        size_t strtoumax;
+        size_t strtof;
+        size_t strtod;
+        size_t strtold;
+        size_t strtol_l;
+        size_t strtoll_l;
+        size_t strtoul_l;
+        size_t strtoull_l;
+        size_t strtof_l;
+        size_t strtod_l;
+        size_t strtold_l;
+        size_t atoi;
+        size_t atol;
+        size_t atoll;
+        size_t atof;
+        size_t strfromf;
+        size_t strfromd;
+        size_t strfroml;
+
+        size_t setlocale;
+        size_t localeconv;
+        size_t newlocale;
+        size_t uselocale;
+        size_t duplocale;
+        size_t freelocale;
+        size_t nl_langinfo;
+
         size_t fopen;
         size_t freopen;
         size_t fclose;
@@ -150,6 +505,27 @@ typedef union thread_local_counters {
         size_t feof;
         size_t ferror;
         size_t perror;
+
+        size_t fgetc;
+        size_t getc;
+        size_t getchar;
+        size_t fgets;
+        size_t ungetc;
+        size_t getline;
+        size_t getdelim;
+        size_t fputc;
+        size_t putc;
+        size_t putchar;
+        size_t fputs;
+        size_t puts;
+        size_t fgetc_unlocked;
+        size_t getc_unlocked;
+        size_t getchar_unlocked;
+        size_t fgets_unlocked;
+        size_t fputc_unlocked;
+        size_t putc_unlocked;
+        size_t putchar_unlocked;
+        size_t fputs_unlocked;
         size_t scanf;
         size_t fscanf;
         size_t sscanf;
@@ -165,6 +541,19 @@ typedef union thread_local_counters {
         size_t vsprintf;
         size_t vsnprintf;
 
+        size_t fgetwc;
+        size_t getwc;
+        size_t fgetws;
+        size_t fputwc;
+        size_t putwc;
+        size_t fputws;
+        size_t fwide;
+        size_t vfwscanf;
+        size_t vswscanf;
+        size_t vwprintf;
+        size_t vfwprintf;
+        size_t vswprintf;
+
         size_t difftime;
         size_t time;
         size_t clock;
@@ -183,6 +572,88 @@ typedef union thread_local_counters {
         size_t localtime_r;
         size_t localtime_s;
         size_t mktime;
+
+        size_t clock_gettime;
+        size_t gettimeofday;
+        size_t nanosleep;
+        size_t clock_nanosleep;
+        size_t usleep;
+        size_t sleep;
+
+        size_t socket;
+        size_t socketpair;
+        size_t accept;
+        size_t accept4;
+        size_t connect;
+        size_t send;
+        size_t sendto;
+        size_t sendmsg;
+        size_t sendmmsg;
+        size_t recv;
+        size_t recvfrom;
+        size_t recvmsg;
+        size_t recvmmsg;
+        size_t poll;
+        size_t select;
+        size_t epoll_wait;
+        size_t epoll_ctl;
+
+        size_t fork;
+        size_t posix_spawn;
+        size_t posix_spawnp;
+        size_t execve;
+        size_t execv;
+        size_t execvp;
+        size_t execvpe;
+        size_t system;
+        size_t popen;
+        size_t pclose;
+        size_t wait;
+        size_t waitpid;
+        size_t wait4;
+
+        size_t dlopen;
+        size_t dlmopen;
+        size_t dlclose;
+        size_t __libc_start_main;
+
+        size_t stat;
+        size_t lstat;
+        size_t fstat;
+        size_t fstatat;
+        size_t statx;
+        size_t access;
+        size_t faccessat;
+        size_t opendir;
+        size_t readdir;
+        size_t closedir;
+        size_t realpath;
+        size_t getcwd;
+        size_t unlink;
+        size_t rename;
+        size_t mkdir;
+        size_t stat64;
+        size_t lstat64;
+        size_t fstat64;
+        size_t fstatat64;
+        size_t readdir64;
+
+        size_t getenv;
+        size_t secure_getenv;
+        size_t setenv;
+        size_t unsetenv;
+        size_t putenv;
+        size_t clearenv;
+
+        size_t getaddrinfo;
+        size_t freeaddrinfo;
+        size_t getnameinfo;
+        size_t gethostbyname;
+        size_t gethostbyname_r;
+        size_t getservbyname;
+        size_t getpwnam;
+        size_t getpwuid;
+        size_t getgrnam;
     } named;
 
     size_t indexed[LIBSEE_MAX_SYMBOLS];
@@ -229,6 +700,37 @@ typedef size_t (*api_wcstombs_t)(char *dest, wchar_t const *src, size_t max);
 typedef int (*api_wcswidth_t)(wchar_t const *wcs, size_t n);
 typedef int (*api_wcwidth_t)(wchar_t wc);
 
+typedef size_t (*api_wcslen_t)(wchar_t const *str);
+typedef size_t (*api_wcsnlen_t)(wchar_t const *str, size_t max);
+typedef int (*api_wcscmp_t)(wchar_t const *lhs, wchar_t const *rhs);
+typedef int (*api_wcsncmp_t)(wchar_t const *lhs, wchar_t const *rhs, size_t count);
+typedef wchar_t *(*api_wcscpy_t)(wchar_t *dest, wchar_t const *src);
+typedef wchar_t *(*api_wcsncpy_t)(wchar_t *dest, wchar_t const *src, size_t count);
+typedef wchar_t *(*api_wcscat_t)(wchar_t *dest, wchar_t const *src);
+typedef wchar_t *(*api_wcschr_t)(wchar_t const *str, wchar_t ch);
+typedef wchar_t *(*api_wcsrchr_t)(wchar_t const *str, wchar_t ch);
+typedef wchar_t *(*api_wcsstr_t)(wchar_t const *haystack, wchar_t const *needle);
+typedef wchar_t *(*api_wcstok_t)(wchar_t *str, wchar_t const *delim, wchar_t **ptr);
+typedef wchar_t *(*api_wmemcpy_t)(wchar_t *dest, wchar_t const *src, size_t count);
+typedef wchar_t *(*api_wmemmove_t)(wchar_t *dest, wchar_t const *src, size_t count);
+typedef wchar_t *(*api_wmemset_t)(wchar_t *dest, wchar_t ch, size_t count);
+typedef int (*api_wmemcmp_t)(wchar_t const *lhs, wchar_t const *rhs, size_t count);
+typedef wchar_t *(*api_wmemchr_t)(wchar_t const *str, wchar_t ch, size_t count);
+typedef int (*api_wcscoll_t)(wchar_t const *lhs, wchar_t const *rhs);
+typedef size_t (*api_wcsxfrm_t)(wchar_t *dest, wchar_t const *src, size_t count);
+
+#include <iconv.h> // `iconv_t`
+#include <wchar.h> // `mbstate_t`, `wint_t`
+
+typedef size_t (*api_mbrtowc_t)(wchar_t *pwc, char const *s, size_t n, mbstate_t *ps);
+typedef size_t (*api_mbstowcs_t)(wchar_t *dst, char const *src, size_t len);
+typedef size_t (*api_wcrtomb_t)(char *s, wchar_t wc, mbstate_t *ps);
+typedef size_t (*api_wcsrtombs_t)(char *dst, wchar_t const **src, size_t len, mbstate_t *ps);
+typedef size_t (*api_mbrlen_t)(char const *s, size_t n, mbstate_t *ps);
+typedef size_t (*api_mbsrtowcs_t)(wchar_t *dst, char const **src, size_t len, mbstate_t *ps);
+typedef wint_t (*api_btowc_t)(int c);
+typedef size_t (*api_iconv_t)(iconv_t cd, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft);
+
 typedef void *(*api_malloc_t)(size_t);
 typedef void *(*api_calloc_t)(size_t, size_t);
 typedef void *(*api_realloc_t)(void *, size_t);
@@ -243,8 +745,259 @@ typedef void *(*api_bsearch_t)(void const *key, void const *base, size_t count,
 typedef void *(*api_bsearch_s_t)(void const *key, void const *base, rsize_t count, rsize_t size,
     int (*compare)(void const *, void const *, void *), void *context);
 
+#include <search.h> // `ENTRY`, `ACTION`, `VISIT`
+
+typedef int (*api_hcreate_t)(size_t capacity);
+typedef ENTRY *(*api_hsearch_t)(ENTRY item, ACTION action);
+typedef void (*api_hdestroy_t)(void);
+typedef int (*api_hcreate_r_t)(size_t capacity, struct hsearch_data *table);
+typedef int (*api_hsearch_r_t)(ENTRY item, ACTION action, ENTRY **found, struct hsearch_data *table);
+typedef void (*api_hdestroy_r_t)(struct hsearch_data *table);
+typedef void *(*api_tsearch_t)(void const *key, void **root, int (*compare)(void const *, void const *));
+typedef void *(*api_tfind_t)(void const *key, void *const *root, int (*compare)(void const *, void const *));
+typedef void *(*api_tdelete_t)(void const *key, void **root, int (*compare)(void const *, void const *));
+typedef void (*api_twalk_t)(void const *root, void (*action)(void const *node, VISIT order, int depth));
+typedef void *(*api_lsearch_t)(void const *key, void *base, size_t *count, size_t size,
+    int (*compare)(void const *, void const *));
+typedef void *(*api_lfind_t)(void const *key, void const *base, size_t *count, size_t size,
+    int (*compare)(void const *, void const *));
+
+#include <fnmatch.h> // `FNM_*` flags
+#include <glob.h>    // `glob_t`
+#include <regex.h>   // `regex_t`, `regmatch_t`
+#include <wordexp.h> // `wordexp_t`
+
+typedef int (*api_regcomp_t)(regex_t *regex, char const *pattern, int flags);
+typedef int (*api_regexec_t)(regex_t const *regex, char const *string, size_t count,
+    regmatch_t matches[_Restrict_arr_ _REGEX_NELTS(count)], int flags);
+typedef size_t (*api_regerror_t)(int code, regex_t const *regex, char *buffer, size_t capacity);
+typedef void (*api_regfree_t)(regex_t *regex);
+typedef int (*api_fnmatch_t)(char const *pattern, char const *string, int flags);
+typedef int (*api_glob_t)(char const *pattern, int flags, int (*on_error)(char const *path, int code), glob_t *paths);
+typedef void (*api_globfree_t)(glob_t *paths);
+typedef int (*api_wordexp_t)(char const *words, wordexp_t *expansion, int flags);
+typedef void (*api_wordfree_t)(wordexp_t *expansion);
+
+/*
+ *  PCRE2 types are only declared, so that the symbol tables look the same with and without the module.
+ *  The header is only included in the module, verifying the signatures of the wrappers against it.
+ */
+#if LIBSEE_PCRE2
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h> // `PCRE2_ZERO_TERMINATED`, `PCRE2_NO_JIT`
+#endif
+
+#include <stdint.h> // `uint8_t`, `uint32_t`
+
+struct pcre2_real_code_8;
+struct pcre2_real_match_data_8;
+struct pcre2_real_compile_context_8;
+struct pcre2_real_match_context_8;
+struct pcre2_real_general_context_8;
+
+typedef struct pcre2_real_code_8 *(*api_pcre2_compile_8_t)(uint8_t const *pattern, size_t length, uint32_t options,
+    int *error_code, size_t *error_offset, struct pcre2_real_compile_context_8 *context);
+typedef void (*api_pcre2_code_free_8_t)(struct pcre2_real_code_8 *code);
+typedef int (*api_pcre2_jit_compile_8_t)(struct pcre2_real_code_8 *code, uint32_t options);
+typedef int (*api_pcre2_match_8_t)(struct pcre2_real_code_8 const *code, uint8_t const *subject, size_t length,
+    size_t offset, uint32_t options, struct pcre2_real_match_data_8 *match_data,
+    struct pcre2_real_match_context_8 *context);
+typedef int (*api_pcre2_jit_match_8_t)(struct pcre2_real_code_8 const *code, uint8_t const *subject, size_t length,
+    size_t offset, uint32_t options, struct pcre2_real_match_data_8 *match_data,
+    struct pcre2_real_match_context_8 *context);
+typedef struct pcre2_real_match_data_8 *(*api_pcre2_match_data_create_8_t)(
+    uint32_t pairs, struct pcre2_real_general_context_8 *context);
+typedef struct pcre2_real_match_data_8 *(*api_pcre2_match_data_create_from_pattern_8_t)(
+    struct pcre2_real_code_8 const *code, struct pcre2_real_general_context_8 *context);
+typedef void (*api_pcre2_match_data_free_8_t)(struct pcre2_real_match_data_8 *match_data);
+
+/*
+ *  BLAS has no standard header, with different implementations using different types for the same arguments,
+ *  so the enumerations are passed as integers and the 32-bit integer interface is assumed.
+ */
+typedef void (*api_cblas_sgemm_t)(int layout, int transpose_a, int transpose_b, int m, int n, int k, float alpha,
+    float const *a, int lda, float const *b, int ldb, float beta, float *c, int ldc);
+typedef void (*api_cblas_dgemm_t)(int layout, int transpose_a, int transpose_b, int m, int n, int k, double alpha,
+    double const *a, int lda, double const *b, int ldb, double beta, double *c, int ldc);
+typedef void (*api_cblas_sgemv_t)(int layout, int transpose, int m, int n, float alpha, float const *a, int lda,
+    float const *x, int incx, float beta, float *y, int incy);
+typedef void (*api_cblas_dgemv_t)(int layout, int transpose, int m, int n, double alpha, double const *a, int lda,
+    double const *x, int incx, double beta, double *y, int incy);
+typedef void (*api_cblas_saxpy_t)(int n, float alpha, float const *x, int incx, float *y, int incy);
+typedef void (*api_cblas_daxpy_t)(int n, double alpha, double const *x, int incx, double *y, int incy);
+typedef float (*api_cblas_sdot_t)(int n, float const *x, int incx, float const *y, int incy);
+typedef double (*api_cblas_ddot_t)(int n, double const *x, int incx, double const *y, int incy);
+typedef void (*api_sgemm__t)(char const *transpose_a, char const *transpose_b, int const *m, int const *n,
+    int const *k, float const *alpha, float const *a, int const *lda, float const *b, int const *ldb,
+    float const *beta, float *c, int const *ldc);
+typedef void (*api_dgemm__t)(char const *transpose_a, char const *transpose_b, int const *m, int const *n,
+    int const *k, double const *alpha, double const *a, int const *lda, double const *b, int const *ldb,
+    double const *beta, double *c, int const *ldc);
+typedef void (*api_sgemv__t)(char const *transpose, int const *m, int const *n, float const *alpha, float const *a,
+    int const *lda, float const *x, int const *incx, float const *beta, float *y, int const *incy);
+typedef void (*api_dgemv__t)(char const *transpose, int const *m, int const *n, double const *alpha,
+    double const *a, int const *lda, double const *x, int const *incx, double const *beta, double *y,
+    int const *incy);
+typedef void (*api_saxpy__t)(int const *n, float const *alpha, float const *x, int const *incx, float *y,
+    int const *incy);
+typedef void (*api_daxpy__t)(int const *n, double const *alpha, double const *x, int const *incx, double *y,
+    int const *incy);
+typedef float (*api_sdot__t)(int const *n, float const *x, int const *incx, float const *y, int const *incy);
+typedef double (*api_ddot__t)(int const *n, double const *x, int const *incx, double const *y, int const *incy);
+typedef void (*api_sgesv__t)(int const *n, int const *nrhs, float *a, int const *lda, int *pivots, float *b,
+    int const *ldb, int *info);
+typedef void (*api_dgesv__t)(int const *n, int const *nrhs, double *a, int const *lda, int *pivots, double *b,
+    int const *ldb, int *info);
+typedef void (*api_sgetrf__t)(int const *m, int const *n, float *a, int const *lda, int *pivots, int *info);
+typedef void (*api_dgetrf__t)(int const *m, int const *n, double *a, int const *lda, int *pivots, int *info);
+typedef void (*api_spotrf__t)(char const *uplo, int const *n, float *a, int const *lda, int *info,
+    size_t uplo_length);
+typedef void (*api_dpotrf__t)(char const *uplo, int const *n, double *a, int const *lda, int *info,
+    size_t uplo_length);
+typedef void (*api_sgeqrf__t)(int const *m, int const *n, float *a, int const *lda, float *tau, float *work,
+    int const *lwork, int *info);
+typedef void (*api_dgeqrf__t)(int const *m, int const *n, double *a, int const *lda, double *tau, double *work,
+    int const *lwork, int *info);
+typedef void (*api_ssyev__t)(char const *jobz, char const *uplo, int const *n, float *a, int const *lda, float *w,
+    float *work, int const *lwork, int *info, size_t jobz_length, size_t uplo_length);
+typedef void (*api_dsyev__t)(char const *jobz, char const *uplo, int const *n, double *a, int const *lda, double *w,
+    double *work, int const *lwork, int *info, size_t jobz_length, size_t uplo_length);
+typedef void (*api_sgesdd__t)(char const *jobz, int const *m, int const *n, float *a, int const *lda, float *s,
+    float *u, int const *ldu, float *vt, int const *ldvt, float *work, int const *lwork, int *iwork, int *info,
+    size_t jobz_length);
+typedef void (*api_dgesdd__t)(char const *jobz, int const *m, int const *n, double *a, int const *lda, double *s,
+    double *u, int const *ldu, double *vt, int const *ldvt, double *work, int const *lwork, int *iwork, int *info,
+    size_t jobz_length);
+
+/*
+ *  zlib types are replaced with the underlying ones, like `Bytef` with `unsigned char` and `uLongf` with
+ *  `unsigned long`, and the header is only included in the module, verifying the signatures of the wrappers.
+ */
+#if LIBSEE_ZLIB
+#include <zlib.h> // `z_stream`
+#endif
+
+struct z_stream_s;
+
+typedef int (*api_deflateInit__t)(struct z_stream_s *stream, int level, char const *version, int stream_size);
+typedef int (*api_deflateInit2__t)(struct z_stream_s *stream, int level, int method, int window_bits, int memory_level,
+    int strategy, char const *version, int stream_size);
+typedef int (*api_deflate_t)(struct z_stream_s *stream, int flush);
+typedef int (*api_deflateReset_t)(struct z_stream_s *stream);
+typedef int (*api_deflateEnd_t)(struct z_stream_s *stream);
+typedef int (*api_inflateInit__t)(struct z_stream_s *stream, char const *version, int stream_size);
+typedef int (*api_inflateInit2__t)(struct z_stream_s *stream, int window_bits, char const *version, int stream_size);
+typedef int (*api_inflate_t)(struct z_stream_s *stream, int flush);
+typedef int (*api_inflateReset_t)(struct z_stream_s *stream);
+typedef int (*api_inflateEnd_t)(struct z_stream_s *stream);
+typedef int (*api_compress2_t)(unsigned char *destination, unsigned long *destination_length,
+    unsigned char const *source, unsigned long source_length, int level);
+typedef int (*api_uncompress_t)(unsigned char *destination, unsigned long *destination_length,
+    unsigned char const *source, unsigned long source_length);
+typedef unsigned long (*api_crc32_t)(unsigned long crc, unsigned char const *buffer, unsigned int length);
+typedef unsigned long (*api_adler32_t)(unsigned long adler, unsigned char const *buffer, unsigned int length);
+
+#include <stdint.h>     // `uint32_t`
+#include <stdlib.h>     // `struct random_data`
+#include <sys/random.h> // `getrandom`
+
 typedef void (*api_srand_t)(unsigned seed);
 typedef int (*api_rand_t)(void);
+typedef long (*api_random_t)(void);
+typedef void (*api_srandom_t)(unsigned seed);
+typedef int (*api_rand_r_t)(unsigned *seed);
+typedef int (*api_random_r_t)(struct random_data *state, int32_t *result);
+typedef double (*api_drand48_t)(void);
+typedef double (*api_erand48_t)(unsigned short state[3]);
+typedef long (*api_lrand48_t)(void);
+typedef long (*api_nrand48_t)(unsigned short state[3]);
+typedef long (*api_mrand48_t)(void);
+typedef long (*api_jrand48_t)(unsigned short state[3]);
+typedef void (*api_srand48_t)(long seed);
+typedef unsigned short *(*api_seed48_t)(unsigned short seed[3]);
+typedef void (*api_lcong48_t)(unsigned short parameters[7]);
+typedef uint32_t (*api_arc4random_t)(void);
+typedef void (*api_arc4random_buf_t)(void *buffer, size_t length);
+typedef uint32_t (*api_arc4random_uniform_t)(uint32_t upper_bound);
+typedef ssize_t (*api_getrandom_t)(void *buffer, size_t length, unsigned int flags);
+
+#pragma region Math // Contents of `math.h`
+
+typedef double (*api_exp_t)(double x);
+typedef float (*api_expf_t)(float x);
+typedef long double (*api_expl_t)(long double x);
+typedef double (*api_log_t)(double x);
+typedef float (*api_logf_t)(float x);
+typedef long double (*api_logl_t)(long double x);
+typedef double (*api_pow_t)(double x, double y);
+typedef float (*api_powf_t)(float x, float y);
+typedef long double (*api_powl_t)(long double x, long double y);
+typedef double (*api_sin_t)(double x);
+typedef float (*api_sinf_t)(float x);
+typedef long double (*api_sinl_t)(long double x);
+typedef double (*api_cos_t)(double x);
+typedef float (*api_cosf_t)(float x);
+typedef long double (*api_cosl_t)(long double x);
+typedef double (*api_sqrt_t)(double x);
+typedef float (*api_sqrtf_t)(float x);
+typedef long double (*api_sqrtl_t)(long double x);
+typedef double (*api_fmod_t)(double x, double y);
+typedef float (*api_fmodf_t)(float x, float y);
+typedef long double (*api_fmodl_t)(long double x, long double y);
+typedef double (*api_erf_t)(double x);
+typedef float (*api_erff_t)(float x);
+typedef long double (*api_erfl_t)(long double x);
+typedef double (*api_lgamma_t)(double x);
+typedef float (*api_lgammaf_t)(float x);
+typedef long double (*api_lgammal_t)(long double x);
+
+#pragma endregion
+
+#pragma region Numeric Conversions // Contents of `stdlib.h` and `inttypes.h`
+
+#include <inttypes.h> // `intmax_t`
+#include <locale.h>   // `locale_t`
+#include <stdlib.h>   // `strtol_l`
+
+typedef long (*api_strtol_t)(char const *str, char **str_end, int base);
+typedef long long (*api_strtoll_t)(char const *str, char **str_end, int base);
+typedef unsigned long (*api_strtoul_t)(char const *str, char **str_end, int base);
+typedef unsigned long long (*api_strtoull_t)(char const *str, char **str_end, int base);
+typedef intmax_t (*api_strtoimax_t)(char const *str, char **str_end, int base);
+typedef uintmax_t (*api_strtoumax_t)(char const *str, char **str_end, int base);
+typedef float (*api_strtof_t)(char const *str, char **str_end);
+typedef double (*api_strtod_t)(char const *str, char **str_end);
+typedef long double (*api_strtold_t)(char const *str, char **str_end);
+typedef long (*api_strtol_l_t)(char const *str, char **str_end, int base, locale_t locale);
+typedef long long (*api_strtoll_l_t)(char const *str, char **str_end, int base, locale_t locale);
+typedef unsigned long (*api_strtoul_l_t)(char const *str, char **str_end, int base, locale_t locale);
+typedef unsigned long long (*api_strtoull_l_t)(char const *str, char **str_end, int base, locale_t locale);
+typedef float (*api_strtof_l_t)(char const *str, char **str_end, locale_t locale);
+typedef double (*api_strtod_l_t)(char const *str, char **str_end, locale_t locale);
+typedef long double (*api_strtold_l_t)(char const *str, char **str_end, locale_t locale);
+typedef int (*api_atoi_t)(char const *str);
+typedef long (*api_atol_t)(char const *str);
+typedef long long (*api_atoll_t)(char const *str);
+typedef double (*api_atof_t)(char const *str);
+typedef int (*api_strfromf_t)(char *str, size_t n, char const *format, float fp);
+typedef int (*api_strfromd_t)(char *str, size_t n, char const *format, double fp);
+typedef int (*api_strfroml_t)(char *str, size_t n, char const *format, long double fp);
+
+#pragma endregion
+
+#pragma region Localization // Contents of `locale.h` and `langinfo.h`
+
+#include <langinfo.h> // `nl_item`
+
+typedef char *(*api_setlocale_t)(int category, char const *locale);
+typedef struct lconv *(*api_localeconv_t)(void);
+typedef locale_t (*api_newlocale_t)(int category_mask, char const *locale, locale_t base);
+typedef locale_t (*api_uselocale_t)(locale_t locale);
+typedef locale_t (*api_duplocale_t)(locale_t locale);
+typedef void (*api_freelocale_t)(locale_t locale);
+typedef char *(*api_nl_langinfo_t)(nl_item item);
+
+#pragma endregion
 
 #pragma region Input / Output // Contents of `stdio.h`
 
@@ -268,6 +1021,28 @@ typedef int (*api_feof_t)(FILE *stream);
 typedef int (*api_ferror_t)(FILE *stream);
 typedef void (*api_perror_t)(char const *s);
 
+// Narrow character input/output
+typedef int (*api_fgetc_t)(FILE *stream);
+typedef int (*api_getc_t)(FILE *stream);
+typedef int (*api_getchar_t)(void);
+typedef char *(*api_fgets_t)(char *str, int count, FILE *stream);
+typedef int (*api_ungetc_t)(int ch, FILE *stream);
+typedef ssize_t (*api_getline_t)(char **line, size_t *capacity, FILE *stream);
+typedef ssize_t (*api_getdelim_t)(char **line, size_t *capacity, int delimiter, FILE *stream);
+typedef int (*api_fputc_t)(int ch, FILE *stream);
+typedef int (*api_putc_t)(int ch, FILE *stream);
+typedef int (*api_putchar_t)(int ch);
+typedef int (*api_fputs_t)(char const *str, FILE *stream);
+typedef int (*api_puts_t)(char const *str);
+typedef int (*api_fgetc_unlocked_t)(FILE *stream);
+typedef int (*api_getc_unlocked_t)(FILE *stream);
+typedef int (*api_getchar_unlocked_t)(void);
+typedef char *(*api_fgets_unlocked_t)(char *str, int count, FILE *stream);
+typedef int (*api_fputc_unlocked_t)(int ch, FILE *stream);
+typedef int (*api_putc_unlocked_t)(int ch, FILE *stream);
+typedef int (*api_putchar_unlocked_t)(int ch);
+typedef int (*api_fputs_unlocked_t)(char const *str, FILE *stream);
+
 // Narrow character input
 typedef int (*api_scanf_t)(char const *format, ...);
 typedef int (*api_fscanf_t)(FILE *stream, char const *format, ...);
@@ -286,11 +1061,26 @@ typedef int (*api_vfprintf_t)(FILE *stream, char const *format, va_list arg);
 typedef int (*api_vsprintf_t)(char *str, char const *format, va_list arg);
 typedef int (*api_vsnprintf_t)(char *str, size_t size, char const *format, va_list arg);
 
+// Wide character input/output
+typedef wint_t (*api_fgetwc_t)(FILE *stream);
+typedef wint_t (*api_getwc_t)(FILE *stream);
+typedef wchar_t *(*api_fgetws_t)(wchar_t *str, int count, FILE *stream);
+typedef wint_t (*api_fputwc_t)(wchar_t ch, FILE *stream);
+typedef wint_t (*api_putwc_t)(wchar_t ch, FILE *stream);
+typedef int (*api_fputws_t)(wchar_t const *str, FILE *stream);
+typedef int (*api_fwide_t)(FILE *stream, int mode);
+typedef int (*api_vfwscanf_t)(FILE *stream, wchar_t const *format, va_list arg);
+typedef int (*api_vswscanf_t)(wchar_t const *buffer, wchar_t const *format, va_list arg);
+typedef int (*api_vwprintf_t)(wchar_t const *format, va_list arg);
+typedef int (*api_vfwprintf_t)(FILE *stream, wchar_t const *format, va_list arg);
+typedef int (*api_vswprintf_t)(wchar_t *buffer, size_t size, wchar_t const *format, va_list arg);
+
 #pragma endregion
 
 #pragma region Date and Time // Contents of `time.h`
 
-#include <time.h> // `time_t`
+#include <sys/time.h> // `struct timeval`
+#include <time.h>     // `time_t`
 
 typedef double (*api_difftime_t)(time_t end, time_t beginning);
 typedef time_t (*api_time_t)(time_t *arg);
@@ -311,6 +1101,144 @@ typedef struct tm *(*api_localtime_r_t)(time_t const *timer, struct tm *result);
 typedef errno_t (*api_localtime_s_t)(time_t const *timer, struct tm *result);
 typedef time_t (*api_mktime_t)(struct tm *timeptr);
 
+// Clocks and sleeps
+typedef int (*api_clock_gettime_t)(clockid_t clock, struct timespec *time);
+typedef int (*api_gettimeofday_t)(struct timeval *time, void *timezone);
+typedef int (*api_nanosleep_t)(struct timespec const *duration, struct timespec *remaining);
+typedef int (*api_clock_nanosleep_t)(clockid_t clock, int flags, struct timespec const *time,
+                                     struct timespec *remaining);
+typedef int (*api_usleep_t)(useconds_t microseconds);
+typedef unsigned int (*api_sleep_t)(unsigned int seconds);
+
+#pragma endregion
+
+#pragma region Networking // Contents of `sys/socket.h`, `poll.h`, `sys/select.h`, and `sys/epoll.h`
+
+#include <poll.h>       // `struct pollfd`
+#include <sys/epoll.h>  // `struct epoll_event`
+#include <sys/select.h> // `fd_set`
+#include <sys/socket.h> // `struct msghdr`, `struct mmsghdr`
+
+typedef int (*api_socket_t)(int domain, int type, int protocol);
+typedef int (*api_socketpair_t)(int domain, int type, int protocol, int fds[2]);
+typedef int (*api_accept_t)(int fd, struct sockaddr *address, socklen_t *address_length);
+typedef int (*api_accept4_t)(int fd, struct sockaddr *address, socklen_t *address_length, int flags);
+typedef int (*api_connect_t)(int fd, struct sockaddr const *address, socklen_t address_length);
+typedef ssize_t (*api_send_t)(int fd, void const *buffer, size_t length, int flags);
+typedef ssize_t (*api_sendto_t)(int fd, void const *buffer, size_t length, int flags, struct sockaddr const *address,
+                                socklen_t address_length);
+typedef ssize_t (*api_sendmsg_t)(int fd, struct msghdr const *message, int flags);
+typedef int (*api_sendmmsg_t)(int fd, struct mmsghdr *messages, unsigned int count, int flags);
+typedef ssize_t (*api_recv_t)(int fd, void *buffer, size_t length, int flags);
+typedef ssize_t (*api_recvfrom_t)(int fd, void *buffer, size_t length, int flags, struct sockaddr *address,
+                                  socklen_t *address_length);
+typedef ssize_t (*api_recvmsg_t)(int fd, struct msghdr *message, int flags);
+typedef int (*api_recvmmsg_t)(int fd, struct mmsghdr *messages, unsigned int count, int flags,
+                              struct timespec *timeout);
+typedef int (*api_poll_t)(struct pollfd *fds, nfds_t count, int timeout);
+typedef int (*api_select_t)(int count, fd_set *read_fds, fd_set *write_fds, fd_set *except_fds,
+                            struct timeval *timeout);
+typedef int (*api_epoll_wait_t)(int epoll_fd, struct epoll_event *events, int max_events, int timeout);
+typedef int (*api_epoll_ctl_t)(int epoll_fd, int operation, int fd, struct epoll_event *event);
+
+#pragma endregion
+
+#pragma region Processes // Contents of `unistd.h`, `spawn.h`, `stdio.h`, `stdlib.h`, and `sys/wait.h`
+
+#include <spawn.h>        // `posix_spawn_file_actions_t`
+#include <sys/resource.h> // `struct rusage`
+#include <sys/wait.h>     // `pid_t`
+
+typedef pid_t (*api_fork_t)(void);
+typedef int (*api_posix_spawn_t)(pid_t *pid, char const *path, posix_spawn_file_actions_t const *file_actions,
+                                 posix_spawnattr_t const *attributes, char *const argv[], char *const envp[]);
+typedef int (*api_posix_spawnp_t)(pid_t *pid, char const *file, posix_spawn_file_actions_t const *file_actions,
+                                  posix_spawnattr_t const *attributes, char *const argv[], char *const envp[]);
+typedef int (*api_execve_t)(char const *path, char *const argv[], char *const envp[]);
+typedef int (*api_execv_t)(char const *path, char *const argv[]);
+typedef int (*api_execvp_t)(char const *file, char *const argv[]);
+typedef int (*api_execvpe_t)(char const *file, char *const argv[], char *const envp[]);
+typedef int (*api_system_t)(char const *command);
+typedef FILE *(*api_popen_t)(char const *command, char const *mode);
+typedef int (*api_pclose_t)(FILE *stream);
+typedef pid_t (*api_wait_t)(int *status);
+typedef pid_t (*api_waitpid_t)(pid_t pid, int *status, int options);
+typedef pid_t (*api_wait4_t)(pid_t pid, int *status, int options, struct rusage *usage);
+
+#pragma endregion
+
+#pragma region Dynamic Loading // Contents of `dlfcn.h`
+
+#include <link.h> // `struct link_map`, `ElfW`
+
+typedef void *(*api_dlopen_t)(char const *filename, int flags);
+typedef void *(*api_dlmopen_t)(Lmid_t namespace_id, char const *filename, int flags);
+typedef int (*api_dlclose_t)(void *handle);
+typedef int (*api___libc_start_main_t)(int (*main)(int, char **, char **), int argc, char **argv, void (*init)(void),
+    void (*fini)(void), void (*rtld_fini)(void), void *stack_end);
+
+#pragma endregion
+
+#pragma region Filesystem Metadata // Contents of `sys/stat.h`, `unistd.h`, `dirent.h`, and `stdlib.h`
+
+#include <dirent.h>   // `DIR`, `struct dirent`
+#include <sys/stat.h> // `struct stat`, `struct statx`
+
+typedef int (*api_stat_t)(char const *path, struct stat *info);
+typedef int (*api_lstat_t)(char const *path, struct stat *info);
+typedef int (*api_fstat_t)(int fd, struct stat *info);
+typedef int (*api_fstatat_t)(int dir_fd, char const *path, struct stat *info, int flags);
+typedef int (*api_statx_t)(int dir_fd, char const *path, int flags, unsigned int mask, struct statx *info);
+typedef int (*api_access_t)(char const *path, int mode);
+typedef int (*api_faccessat_t)(int dir_fd, char const *path, int mode, int flags);
+typedef DIR *(*api_opendir_t)(char const *path);
+typedef struct dirent *(*api_readdir_t)(DIR *directory);
+typedef int (*api_closedir_t)(DIR *directory);
+typedef char *(*api_realpath_t)(char const *path, char *resolved_path);
+typedef char *(*api_getcwd_t)(char *buffer, size_t size);
+typedef int (*api_unlink_t)(char const *path);
+typedef int (*api_rename_t)(char const *old_path, char const *new_path);
+typedef int (*api_mkdir_t)(char const *path, mode_t mode);
+
+// Large-file variants, that glibc exports separately, and most programs built with `_FILE_OFFSET_BITS=64` call
+typedef int (*api_stat64_t)(char const *path, struct stat64 *info);
+typedef int (*api_lstat64_t)(char const *path, struct stat64 *info);
+typedef int (*api_fstat64_t)(int fd, struct stat64 *info);
+typedef int (*api_fstatat64_t)(int dir_fd, char const *path, struct stat64 *info, int flags);
+typedef struct dirent64 *(*api_readdir64_t)(DIR *directory);
+
+#pragma endregion
+
+#pragma region Environment // Contents of `stdlib.h`
+
+typedef char *(*api_getenv_t)(char const *name);
+typedef char *(*api_secure_getenv_t)(char const *name);
+typedef int (*api_setenv_t)(char const *name, char const *value, int overwrite);
+typedef int (*api_unsetenv_t)(char const *name);
+typedef int (*api_putenv_t)(char *assignment);
+typedef int (*api_clearenv_t)(void);
+
+#pragma endregion
+
+#pragma region Name Resolution // Contents of `netdb.h`, `pwd.h`, and `grp.h`
+
+#include <grp.h>   // `struct group`
+#include <netdb.h> // `struct addrinfo`, `struct hostent`, `struct servent`
+#include <pwd.h>   // `struct passwd`
+
+typedef int (*api_getaddrinfo_t)(char const *node, char const *service, struct addrinfo const *hints,
+    struct addrinfo **results);
+typedef void (*api_freeaddrinfo_t)(struct addrinfo *results);
+typedef int (*api_getnameinfo_t)(struct sockaddr const *address, socklen_t address_length, char *host,
+    socklen_t host_length, char *service, socklen_t service_length, int flags);
+typedef struct hostent *(*api_gethostbyname_t)(char const *name);
+typedef int (*api_gethostbyname_r_t)(char const *name, struct hostent *host, char *buffer, size_t buffer_length,
+    struct hostent **result, int *error);
+typedef struct servent *(*api_getservbyname_t)(char const *name, char const *protocol);
+typedef struct passwd *(*api_getpwnam_t)(char const *name);
+typedef struct passwd *(*api_getpwuid_t)(uid_t uid);
+typedef struct group *(*api_getgrnam_t)(char const *name);
+
 #pragma endregion
 
 #pragma endregion
@@ -359,6 +1287,34 @@ typedef struct real_apis {
     api_wcswidth_t wcswidth;
     api_wcwidth_t wcwidth;
 
+    api_wcslen_t wcslen;
+    api_wcsnlen_t wcsnlen;
+    api_wcscmp_t wcscmp;
+    api_wcsncmp_t wcsncmp;
+    api_wcscpy_t wcscpy;
+    api_wcsncpy_t wcsncpy;
+    api_wcscat_t wcscat;
+    api_wcschr_t wcschr;
+    api_wcsrchr_t wcsrchr;
+    api_wcsstr_t wcsstr;
+    api_wcstok_t wcstok;
+    api_wmemcpy_t wmemcpy;
+    api_wmemmove_t wmemmove;
+    api_wmemset_t wmemset;
+    api_wmemcmp_t wmemcmp;
+    api_wmemchr_t wmemchr;
+    api_wcscoll_t wcscoll;
+    api_wcsxfrm_t wcsxfrm;
+
+    api_mbrtowc_t mbrtowc;
+    api_mbstowcs_t mbstowcs;
+    api_wcrtomb_t wcrtomb;
+    api_wcsrtombs_t wcsrtombs;
+    api_mbrlen_t mbrlen;
+    api_mbsrtowcs_t mbsrtowcs;
+    api_btowc_t btowc;
+    api_iconv_t iconv;
+
     api_malloc_t malloc;
     api_calloc_t calloc;
     api_realloc_t realloc;
@@ -370,9 +1326,163 @@ typedef struct real_apis {
     api_bsearch_t bsearch;
     api_bsearch_s_t bsearch_s;
 
+    api_hcreate_t hcreate;
+    api_hsearch_t hsearch;
+    api_hdestroy_t hdestroy;
+    api_hcreate_r_t hcreate_r;
+    api_hsearch_r_t hsearch_r;
+    api_hdestroy_r_t hdestroy_r;
+    api_tsearch_t tsearch;
+    api_tfind_t tfind;
+    api_tdelete_t tdelete;
+    api_twalk_t twalk;
+    api_lsearch_t lsearch;
+    api_lfind_t lfind;
+
+    api_regcomp_t regcomp;
+    api_regexec_t regexec;
+    api_regerror_t regerror;
+    api_regfree_t regfree;
+    api_fnmatch_t fnmatch;
+    api_glob_t glob;
+    api_globfree_t globfree;
+    api_wordexp_t wordexp;
+    api_wordfree_t wordfree;
+
+    api_pcre2_compile_8_t pcre2_compile_8;
+    api_pcre2_code_free_8_t pcre2_code_free_8;
+    api_pcre2_jit_compile_8_t pcre2_jit_compile_8;
+    api_pcre2_match_8_t pcre2_match_8;
+    api_pcre2_jit_match_8_t pcre2_jit_match_8;
+    api_pcre2_match_data_create_8_t pcre2_match_data_create_8;
+    api_pcre2_match_data_create_from_pattern_8_t pcre2_match_data_create_from_pattern_8;
+    api_pcre2_match_data_free_8_t pcre2_match_data_free_8;
+
+    api_cblas_sgemm_t cblas_sgemm;
+    api_cblas_dgemm_t cblas_dgemm;
+    api_cblas_sgemv_t cblas_sgemv;
+    api_cblas_dgemv_t cblas_dgemv;
+    api_cblas_saxpy_t cblas_saxpy;
+    api_cblas_daxpy_t cblas_daxpy;
+    api_cblas_sdot_t cblas_sdot;
+    api_cblas_ddot_t cblas_ddot;
+    api_sgemm__t sgemm_;
+    api_dgemm__t dgemm_;
+    api_sgemv__t sgemv_;
+    api_dgemv__t dgemv_;
+    api_saxpy__t saxpy_;
+    api_daxpy__t daxpy_;
+    api_sdot__t sdot_;
+    api_ddot__t ddot_;
+
+    api_sgesv__t sgesv_;
+    api_dgesv__t dgesv_;
+    api_sgetrf__t sgetrf_;
+    api_dgetrf__t dgetrf_;
+    api_spotrf__t spotrf_;
+    api_dpotrf__t dpotrf_;
+    api_sgeqrf__t sgeqrf_;
+    api_dgeqrf__t dgeqrf_;
+    api_ssyev__t ssyev_;
+    api_dsyev__t dsyev_;
+    api_sgesdd__t sgesdd_;
+    api_dgesdd__t dgesdd_;
+
+    api_deflateInit__t deflateInit_;
+    api_deflateInit2__t deflateInit2_;
+    api_deflate_t deflate;
+    api_deflateReset_t deflateReset;
+    api_deflateEnd_t deflateEnd;
+    api_inflateInit__t inflateInit_;
+    api_inflateInit2__t inflateInit2_;
+    api_inflate_t inflate;
+    api_inflateReset_t inflateReset;
+    api_inflateEnd_t inflateEnd;
+    api_compress2_t compress2;
+    api_uncompress_t uncompress;
+    api_crc32_t crc32;
+    api_adler32_t adler32;
+
     api_srand_t srand;
     api_rand_t rand;
 
+    api_random_t random;
+    api_srandom_t srandom;
+    api_rand_r_t rand_r;
+    api_random_r_t random_r;
+    api_drand48_t drand48;
+    api_erand48_t erand48;
+    api_lrand48_t lrand48;
+    api_nrand48_t nrand48;
+    api_mrand48_t mrand48;
+    api_jrand48_t jrand48;
+    api_srand48_t srand48;
+    api_seed48_t seed48;
+    api_lcong48_t lcong48;
+    api_arc4random_t arc4random;
+    api_arc4random_buf_t arc4random_buf;
+    api_arc4random_uniform_t arc4random_uniform;
+    api_getrandom_t getrandom;
+    api_exp_t exp;
+    api_expf_t expf;
+    api_expl_t expl;
+    api_log_t log;
+    api_logf_t logf;
+    api_logl_t logl;
+    api_pow_t pow;
+    api_powf_t powf;
+    api_powl_t powl;
+    api_sin_t sin;
+    api_sinf_t sinf;
+    api_sinl_t sinl;
+    api_cos_t cos;
+    api_cosf_t cosf;
+    api_cosl_t cosl;
+    api_sqrt_t sqrt;
+    api_sqrtf_t sqrtf;
+    api_sqrtl_t sqrtl;
+    api_fmod_t fmod;
+    api_fmodf_t fmodf;
+    api_fmodl_t fmodl;
+    api_erf_t erf;
+    api_erff_t erff;
+    api_erfl_t erfl;
+    api_lgamma_t lgamma;
+    api_lgammaf_t lgammaf;
+    api_lgammal_t lgammal;
+
+    api_strtol_t strtol;
+    api_strtoll_t strtoll;
+    api_strtoul_t strtoul;
+    api_strtoull_t strtoull;
+    api_strtoimax_t strtoimax;
+    api_strtoumax_t strtoumax;
+    api_strtof_t strtof;
+    api_strtod_t strtod;
+    api_strtold_t strtold;
+    api_strtol_l_t strtol_l;
+    api_strtoll_l_t strtoll_l;
+    api_strtoul_l_t strtoul_l;
+    api_strtoull_l_t strtoull_l;
+    api_strtof_l_t strtof_l;
+    api_strtod_l_t strtod_l;
+    api_strtold_l_t strtold_l;
+    api_atoi_t atoi;
+    api_atol_t atol;
+    api_atoll_t atoll;
+    api_atof_t atof;
+    api_strfromf_t strfromf;
+    api_strfromd_t strfromd;
+    api_strfroml_t strfroml;
+
+    api_setlocale_t setlocale;
+    api_localeconv_t localeconv;
+    api_newlocale_t newlocale;
+    api_uselocale_t uselocale;
+    api_duplocale_t duplocale;
+    api_freelocale_t freelocale;
+    api_nl_langinfo_t nl_langinfo;
+
     api_fopen_t fopen;
     api_freopen_t freopen;
     api_fclose_t fclose;
@@ -390,6 +1500,27 @@ typedef struct real_apis {
     api_feof_t feof;
     api_ferror_t ferror;
     api_perror_t perror;
+
+    api_fgetc_t fgetc;
+    api_getc_t getc;
+    api_getchar_t getchar;
+    api_fgets_t fgets;
+    api_ungetc_t ungetc;
+    api_getline_t getline;
+    api_getdelim_t getdelim;
+    api_fputc_t fputc;
+    api_putc_t putc;
+    api_putchar_t putchar;
+    api_fputs_t fputs;
+    api_puts_t puts;
+    api_fgetc_unlocked_t fgetc_unlocked;
+    api_getc_unlocked_t getc_unlocked;
+    api_getchar_unlocked_t getchar_unlocked;
+    api_fgets_unlocked_t fgets_unlocked;
+    api_fputc_unlocked_t fputc_unlocked;
+    api_putc_unlocked_t putc_unlocked;
+    api_putchar_unlocked_t putchar_unlocked;
+    api_fputs_unlocked_t fputs_unlocked;
     api_scanf_t scanf;
     api_fscanf_t fscanf;
     api_sscanf_t sscanf;
@@ -405,6 +1536,19 @@ typedef struct real_apis {
     api_vsprintf_t vsprintf;
     api_vsnprintf_t vsnprintf;
 
+    api_fgetwc_t fgetwc;
+    api_getwc_t getwc;
+    api_fgetws_t fgetws;
+    api_fputwc_t fputwc;
+    api_putwc_t putwc;
+    api_fputws_t fputws;
+    api_fwide_t fwide;
+    api_vfwscanf_t vfwscanf;
+    api_vswscanf_t vswscanf;
+    api_vwprintf_t vwprintf;
+    api_vfwprintf_t vfwprintf;
+    api_vswprintf_t vswprintf;
+
     api_difftime_t difftime;
     api_time_t time;
     api_clock_t clock;
@@ -423,6 +1567,88 @@ typedef struct real_apis {
     api_localtime_r_t localtime_r;
     api_localtime_s_t localtime_s;
     api_mktime_t mktime;
+
+    api_clock_gettime_t clock_gettime;
+    api_gettimeofday_t gettimeofday;
+    api_nanosleep_t nanosleep;
+    api_clock_nanosleep_t clock_nanosleep;
+    api_usleep_t usleep;
+    api_sleep_t sleep;
+
+    api_socket_t socket;
+    api_socketpair_t socketpair;
+    api_accept_t accept;
+    api_accept4_t accept4;
+    api_connect_t connect;
+    api_send_t send;
+    api_sendto_t sendto;
+    api_sendmsg_t sendmsg;
+    api_sendmmsg_t sendmmsg;
+    api_recv_t recv;
+    api_recvfrom_t recvfrom;
+    api_recvmsg_t recvmsg;
+    api_recvmmsg_t recvmmsg;
+    api_poll_t poll;
+    api_select_t select;
+    api_epoll_wait_t epoll_wait;
+    api_epoll_ctl_t epoll_ctl;
+
+    api_fork_t fork;
+    api_posix_spawn_t posix_spawn;
+    api_posix_spawnp_t posix_spawnp;
+    api_execve_t execve;
+    api_execv_t execv;
+    api_execvp_t execvp;
+    api_execvpe_t execvpe;
+    api_system_t system;
+    api_popen_t popen;
+    api_pclose_t pclose;
+    api_wait_t wait;
+    api_waitpid_t waitpid;
+    api_wait4_t wait4;
+
+    api_dlopen_t dlopen;
+    api_dlmopen_t dlmopen;
+    api_dlclose_t dlclose;
+    api___libc_start_main_t __libc_start_main;
+
+    api_stat_t stat;
+    api_lstat_t lstat;
+    api_fstat_t fstat;
+    api_fstatat_t fstatat;
+    api_statx_t statx;
+    api_access_t access;
+    api_faccessat_t faccessat;
+    api_opendir_t opendir;
+    api_readdir_t readdir;
+    api_closedir_t closedir;
+    api_realpath_t realpath;
+    api_getcwd_t getcwd;
+    api_unlink_t unlink;
+    api_rename_t rename;
+    api_mkdir_t mkdir;
+    api_stat64_t stat64;
+    api_lstat64_t lstat64;
+    api_fstat64_t fstat64;
+    api_fstatat64_t fstatat64;
+    api_readdir64_t readdir64;
+
+    api_getenv_t getenv;
+    api_secure_getenv_t secure_getenv;
+    api_setenv_t setenv;
+    api_unsetenv_t unsetenv;
+    api_putenv_t putenv;
+    api_clearenv_t clearenv;
+
+    api_getaddrinfo_t getaddrinfo;
+    api_freeaddrinfo_t freeaddrinfo;
+    api_getnameinfo_t getnameinfo;
+    api_gethostbyname_t gethostbyname;
+    api_gethostbyname_r_t gethostbyname_r;
+    api_getservbyname_t getservbyname;
+    api_getpwnam_t getpwnam;
+    api_getpwuid_t getpwuid;
+    api_getgrnam_t getgrnam;
 } real_apis;
 
 #define COMPILE_TIME_ASSERT(predicate, message) typedef char message[(predicate) ? 1 : -1]
@@ -432,6 +1658,49 @@ static real_apis libsee_apis = {NULL};
 static thread_local_counters libsee_thread_cycles[LIBSEE_MAX_THREADS] = {0};
 static thread_local_counters libsee_thread_calls[LIBSEE_MAX_THREADS] = {0};
 
+/**
+ *  @brief  Number of bytes or characters processed by each function, wherever that can be inferred
+ *          from the arguments or the returned values. Stays zero for all other functions.
+ */
+static thread_local_counters libsee_thread_bytes[LIBSEE_MAX_THREADS] = {0};
+
+/**
+ *  @brief  Power-of-two histogram, where the bucket `i` counts values with exactly `i` significant bits.
+ *          Zero lands in the first bucket, and every 64-bit value fits into one of the 65 buckets.
+ *
+ *  Unlike the counters above, histograms are shared between threads and updated with relaxed atomics.
+ */
+#define LIBSEE_HISTOGRAM_BUCKETS 65
+typedef struct libsee_histogram {
+    size_t buckets[LIBSEE_HISTOGRAM_BUCKETS];
+} libsee_histogram;
+
+/**
+ *  @brief  Slot of a fixed-capacity open-addressing hash table, attributing calls of a specific function
+ *          to an "origin", like the call site or the thread. Slots are claimed with a CAS on the `key`,
+ *          and the counters are updated with relaxed atomics, so the tables are shared between threads.
+ */
+typedef struct libsee_keyed_stats {
+    size_t key;                // Non-zero hash of the function name and the origin, or zero for free slots
+    char const *function_name; // Static string with the name of the intercepted function
+    size_t origin;             // Call-site address or thread identifier
+    size_t calls;
+    size_t cycles;
+    size_t bytes;
+} libsee_keyed_stats;
+
+static libsee_keyed_stats libsee_call_sites[LIBSEE_MAX_CALL_SITES] = {0};
+static libsee_keyed_stats libsee_threads[LIBSEE_MAX_THREADS] = {0};
+
+/**
+ *  @brief  Tracks the peak number of calls within a single second of wall-clock time.
+ */
+typedef struct libsee_rate_stats {
+    size_t window_second;
+    size_t window_calls;
+    size_t peak_calls;
+} libsee_rate_stats;
+
 #pragma region Global Helpers
 
 void libsee_initialize_if_not(void);
@@ -559,6 +1828,150 @@ void close_stdout(void) {
     (void)ret;
 }
 
+void libsee_histogram_add(libsee_histogram *histogram, size_t value) {
+    size_t bucket = value ? (size_t)(64 - __builtin_clzll((unsigned long long)value)) : 0;
+    __atomic_fetch_add(&histogram->buckets[bucket], 1, __ATOMIC_RELAXED);
+}
+
+size_t libsee_get_thread_id(void) {
+    static __thread size_t thread_id = 0;
+    if (__builtin_expect(thread_id == 0, 0)) {
+#if defined(__linux__)
+        thread_id = (size_t)syscall(SYS_gettid);
+#else
+        thread_id = (size_t)pthread_self();
+#endif
+    }
+    return thread_id;
+}
+
+static inline int libsee_names_equal(char const *first, char const *second) {
+    while (*first && *first == *second) ++first, ++second;
+    return *first == *second;
+}
+
+/**
+ *  @brief  Compares a null-terminated string stored in a slot against `length` characters of another one.
+ */
+static inline int libsee_stored_equal(char const *stored, char const *text, size_t length) {
+    size_t i = 0;
+    while (i != length && stored[i] == text[i]) ++i;
+    return i == length && stored[i] == 0;
+}
+
+static inline void libsee_store_string(char *stored, char const *text, size_t length) {
+    for (size_t i = 0; i != length; ++i) stored[i] = text[i];
+    stored[length] = 0;
+}
+
+/*
+ *  Every shared table keeps the key in the first field of its slots. A free slot is claimed by replacing
+ *  its zero key with a "busy" one, and is only published with the final key once its identity is written,
+ *  so that the concurrent lookups of the same key wait for it, rather than comparing against half-written
+ *  fields and claiming a duplicate. Published keys are odd, and the busy ones are even.
+ */
+typedef int (*libsee_slot_matches_t)(void const *slot, void const *identity);
+typedef void (*libsee_slot_fill_t)(void *slot, void const *identity);
+
+static size_t libsee_dropped_updates = 0;
+
+static inline int libsee_slot_is_published(size_t key) { return (int)(key & 1); }
+
+/**
+ *  @brief  Finds or claims the slot for the given identity, probing at most `LIBSEE_MAX_PROBES` slots.
+ *  @return NULL if there is no such slot and no free one, counting the dropped update.
+ */
+void *libsee_shared_slot(void *slots, size_t slot_size, size_t capacity, size_t hash, void const *identity,
+    libsee_slot_matches_t matches, libsee_slot_fill_t fill) {
+    size_t published = hash | 3, busy = published & ~(size_t)1;
+    size_t probes = capacity < LIBSEE_MAX_PROBES ? capacity : LIBSEE_MAX_PROBES;
+    for (size_t probe = 0; probe < probes; probe++) {
+        char *slot = (char *)slots + ((hash + probe) % capacity) * slot_size;
+        size_t *key = (size_t *)slot;
+        size_t existing = __atomic_load_n(key, __ATOMIC_ACQUIRE);
+        if (existing == 0 && __atomic_compare_exchange_n(key, &existing, busy, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            fill(slot, identity);
+            __atomic_store_n(key, published, __ATOMIC_RELEASE);
+            return slot;
+        }
+        while (existing == busy) existing = __atomic_load_n(key, __ATOMIC_ACQUIRE);
+        if (existing == published && matches(slot, identity)) return slot;
+    }
+    __atomic_fetch_add(&libsee_dropped_updates, 1, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+typedef struct libsee_keyed_identity {
+    char const *function_name;
+    size_t origin;
+} libsee_keyed_identity;
+
+int libsee_keyed_matches(void const *slot, void const *identity) {
+    libsee_keyed_stats const *stats = (libsee_keyed_stats const *)slot;
+    libsee_keyed_identity const *keyed = (libsee_keyed_identity const *)identity;
+    return stats->origin == keyed->origin && stats->function_name == keyed->function_name;
+}
+
+void libsee_keyed_fill(void *slot, void const *identity) {
+    libsee_keyed_stats *stats = (libsee_keyed_stats *)slot;
+    libsee_keyed_identity const *keyed = (libsee_keyed_identity const *)identity;
+    stats->function_name = keyed->function_name;
+    stats->origin = keyed->origin;
+}
+
+/**
+ *  @brief  Finds or claims the slot for the given function and origin.
+ *  @return NULL if the table is full.
+ */
+libsee_keyed_stats *libsee_keyed_slot(
+    libsee_keyed_stats *slots, size_t capacity, char const *function_name, size_t origin) {
+    // Origins and names are both pointer-like and often differ in the lowest bits, so mix them separately
+    unsigned long long hash = (unsigned long long)origin * 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ (hash >> 32) ^ (unsigned long long)(size_t)function_name) * 0xBF58476D1CE4E5B9ull;
+    libsee_keyed_identity identity = {function_name, origin};
+    return (libsee_keyed_stats *)libsee_shared_slot(slots, sizeof(libsee_keyed_stats), capacity,
+        (size_t)(hash ^ (hash >> 29)), &identity, libsee_keyed_matches, libsee_keyed_fill);
+}
+
+void libsee_keyed_add(libsee_keyed_stats *slots, size_t capacity, char const *function_name, size_t origin,
+    size_t cycles, size_t bytes) {
+    libsee_keyed_stats *slot = libsee_keyed_slot(slots, capacity, function_name, origin);
+    if (!slot) return;
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->cycles, cycles, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->bytes, bytes, __ATOMIC_RELAXED);
+}
+
+/*
+ *  Both must be expanded directly inside of the exported wrapper, so that the return address
+ *  points to the application code calling LibC.
+ */
+#define libsee_track_call_site(function_name, cycles)                                                             \
+    libsee_keyed_add(libsee_call_sites, LIBSEE_MAX_CALL_SITES, #function_name, (size_t)__builtin_return_address(0), \
+        cycles, 0)
+#define libsee_track_thread(function_name, cycles) \
+    libsee_keyed_add(libsee_threads, LIBSEE_MAX_THREADS, #function_name, libsee_get_thread_id(), cycles, 0)
+
+void libsee_rate_add(libsee_rate_stats *rate) {
+    struct timespec now;
+#if defined(CLOCK_MONOTONIC_COARSE)
+    libsee_apis.clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+#else
+    libsee_apis.clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+    size_t second = (size_t)now.tv_sec;
+    size_t window_second = __atomic_load_n(&rate->window_second, __ATOMIC_RELAXED);
+    if (second != window_second &&
+        __atomic_compare_exchange_n(&rate->window_second, &window_second, second, 0, __ATOMIC_RELAXED,
+            __ATOMIC_RELAXED))
+        __atomic_store_n(&rate->window_calls, 0, __ATOMIC_RELAXED);
+    size_t calls = __atomic_add_fetch(&rate->window_calls, 1, __ATOMIC_RELAXED);
+    size_t peak_calls = __atomic_load_n(&rate->peak_calls, __ATOMIC_RELAXED);
+    while (calls > peak_calls &&
+           !__atomic_compare_exchange_n(&rate->peak_calls, &peak_calls, calls, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+}
+
 #if LIBSEE_LOG_EVERYTHING
 #define libsee_log(str, count) syscall_print(str, count)
 #else
@@ -596,6 +2009,27 @@ void close_stdout(void) {
         return _result;                                                      \
     } while (0)
 
+/**
+ *  Same as `libsee_return`, but also adds `bytes_count` to `libsee_thread_bytes` of the same CPU.
+ *  The expression is evaluated after the call and can refer to the returned value as `_result`.
+ */
+#define libsee_return_bytes(function_name, return_type, bytes_count, ...)     \
+    do {                                                                      \
+        libsee_initialize_if_not();                                           \
+        libsee_log(#function_name "-started\n", sizeof(#function_name) + 9);  \
+        size_t _cpu_index, _cycle_count_start, _cycle_count_end;              \
+        _cpu_index = libsee_get_cpu_index();                                  \
+        _cycle_count_start = libsee_get_cpu_cycle();                          \
+        return_type _result = libsee_apis.function_name(__VA_ARGS__);         \
+        _cycle_count_end = libsee_get_cpu_cycle();                            \
+        size_t cycle_count = _cycle_count_end - _cycle_count_start;           \
+        libsee_thread_cycles[_cpu_index].named.function_name += cycle_count;  \
+        libsee_thread_calls[_cpu_index].named.function_name++;                \
+        libsee_thread_bytes[_cpu_index].named.function_name += (bytes_count); \
+        libsee_log(#function_name "-closed\n", sizeof(#function_name) + 8);   \
+        return _result;                                                       \
+    } while (0)
+
 #define libsee_assign(returned_value, function_name, ...)                    \
     do {                                                                     \
         libsee_initialize_if_not();                                          \
@@ -611,30 +2045,172 @@ void close_stdout(void) {
         libsee_log(#function_name "-closed\n", sizeof(#function_name) + 8);  \
     } while (0)
 
-#if defined(_WIN32) || defined(__CYGWIN__)
-#if defined(__GNUC__)
-#define libsee_export __attribute__((dllexport))
-#else
-#define libsee_export __declspec(dllexport)
-#endif
-#else
-#if __GNUC__ >= 4
-#define libsee_export __attribute__((visibility("default")))
-#else
-#define libsee_export
-#endif
-#endif
+/**
+ *  Same as `libsee_assign`, but also exports the number of spent cycles into `cycles`,
+ *  so the call can be attributed to its call site or thread.
+ */
+#define libsee_assign_cycles(returned_value, cycles, function_name, ...)     \
+    do {                                                                     \
+        libsee_initialize_if_not();                                          \
+        libsee_log(#function_name "-started\n", sizeof(#function_name) + 9); \
+        size_t _cpu_index, _cycle_count_start, _cycle_count_end;             \
+        _cpu_index = libsee_get_cpu_index();                                 \
+        _cycle_count_start = libsee_get_cpu_cycle();                         \
+        returned_value = libsee_apis.function_name(__VA_ARGS__);             \
+        _cycle_count_end = libsee_get_cpu_cycle();                           \
+        size_t cycle_count = _cycle_count_end - _cycle_count_start;          \
+        libsee_thread_cycles[_cpu_index].named.function_name += cycle_count; \
+        libsee_thread_calls[_cpu_index].named.function_name++;               \
+        libsee_log(#function_name "-closed\n", sizeof(#function_name) + 8);  \
+        cycles = cycle_count;                                                \
+    } while (0)
 
-#pragma endregion
+#define libsee_noreturn_cycles(cycles, function_name, ...)                   \
+    do {                                                                     \
+        libsee_initialize_if_not();                                          \
+        libsee_log(#function_name "-started\n", sizeof(#function_name) + 9); \
+        size_t _cpu_index, _cycle_count_start, _cycle_count_end;             \
+        _cpu_index = libsee_get_cpu_index();                                 \
+        _cycle_count_start = libsee_get_cpu_cycle();                         \
+        libsee_apis.function_name(__VA_ARGS__);                              \
+        _cycle_count_end = libsee_get_cpu_cycle();                           \
+        size_t cycle_count = _cycle_count_end - _cycle_count_start;          \
+        libsee_thread_cycles[_cpu_index].named.function_name += cycle_count; \
+        libsee_thread_calls[_cpu_index].named.function_name++;               \
+        libsee_log(#function_name "-closed\n", sizeof(#function_name) + 8);  \
+        cycles = cycle_count;                                                \
+    } while (0)
 
-#pragma region Strings // Contents of `string.h`
+#define libsee_add_bytes(function_name, count) \
+    (libsee_thread_bytes[libsee_get_cpu_index()].named.function_name += (size_t)(count))
 
-/** copies one string to another
- *  https://en.cppreference.com/w/c/string/byte/strcpy
+/*
+ *  For the wrappers, that make several calls to the original functions, but should count as one.
  */
-libsee_export char *strcpy(char *dest, char const *src) { libsee_return(strcpy, char *, dest, src); }
-libsee_export errno_t strcpy_s(char *dest, rsize_t destsz, char const *src) {
-    libsee_return(strcpy_s, errno_t, dest, destsz, src);
+#define libsee_add_call(function_name, cycles)                                    \
+    do {                                                                          \
+        size_t _cpu_index = libsee_get_cpu_index();                               \
+        libsee_thread_cycles[_cpu_index].named.function_name += (size_t)(cycles); \
+        libsee_thread_calls[_cpu_index].named.function_name++;                    \
+    } while (0)
+
+/**
+ *  @brief  Finds the definition of a symbol outside of LibSee, for the libraries that may be loaded later.
+ *
+ *  `RTLD_NEXT` only searches the global scope, missing the libraries loaded as dependencies of the plugins
+ *  opened with `RTLD_LOCAL`, so the loaded objects are then searched one by one. If nothing is found,
+ *  the process is terminated with a message, as there is nothing to forward the call to.
+ */
+void *libsee_find_symbol(char const *name) {
+    libsee_initialize_if_not();
+    void *address = dlsym(RTLD_NEXT, name);
+    if (address) return address;
+    dlerror(); // Discard the error of the probe
+
+    Dl_info own, found;
+    struct link_map *map = NULL;
+    void *global = libsee_apis.dlopen(NULL, RTLD_LAZY | RTLD_NOLOAD);
+    if (global && dladdr((void *)&libsee_find_symbol, &own) && dlinfo(global, RTLD_DI_LINKMAP, &map) == 0)
+        for (; map && !address; map = map->l_next) {
+            if (!map->l_name || !*map->l_name) continue;
+            void *handle = libsee_apis.dlopen(map->l_name, RTLD_LAZY | RTLD_NOLOAD);
+            if (!handle) continue;
+            address = dlsym(handle, name);
+            if (address && dladdr(address, &found) && found.dli_fbase == own.dli_fbase) address = NULL;
+            libsee_apis.dlclose(handle);
+        }
+    if (global) libsee_apis.dlclose(global);
+    dlerror();
+    if (address) return address;
+
+    char message[256] = "LibSee: can't find the original definition of ";
+    size_t length = 0;
+    while (message[length]) ++length;
+    for (; *name && length + 2 < sizeof(message); ++name) message[length++] = *name;
+    message[length++] = '\n';
+    syscall_print(message, length);
+    abort();
+}
+
+/*
+ *  Resolves the symbols of the libraries, that may be loaded after LibSee is initialized, on the first call.
+ *  Concurrent calls may resolve the same symbol twice, storing the same address.
+ */
+#define libsee_resolve_lazily(function_name)                                                     \
+    do {                                                                                         \
+        if (__builtin_expect(!__atomic_load_n(&libsee_apis.function_name, __ATOMIC_ACQUIRE), 0)) \
+            __atomic_store_n(&libsee_apis.function_name,                                         \
+                (api_##function_name##_t)libsee_find_symbol(#function_name), __ATOMIC_RELEASE);  \
+    } while (0)
+
+#if LIBSEE_PCRE2 || LIBSEE_BLAS || LIBSEE_ZLIB
+
+/*
+ *  The libraries beyond LibC call their own exported functions, like `pcre2_match_8` running `pcre2_jit_match_8`,
+ *  or LAPACK calling BLAS, and those calls are interposed again. So the optional modules track the depth of their
+ *  calls on every thread, and only record the outermost ones, forwarding the nested calls. Once the original
+ *  function returns, the depth is restored, and a non-zero value tells the wrapper to skip its own accounting.
+ */
+static __thread size_t libsee_module_depth = 0;
+
+#define libsee_module_assign(result, function_name, ...)                            \
+    do {                                                                            \
+        libsee_resolve_lazily(function_name);                                       \
+        if (libsee_module_depth++) result = libsee_apis.function_name(__VA_ARGS__); \
+        else libsee_assign(result, function_name, __VA_ARGS__);                     \
+        libsee_module_depth--;                                                      \
+    } while (0)
+
+#define libsee_module_noreturn(function_name, ...)                         \
+    do {                                                                   \
+        libsee_resolve_lazily(function_name);                              \
+        if (libsee_module_depth++) libsee_apis.function_name(__VA_ARGS__); \
+        else libsee_noreturn(function_name, __VA_ARGS__);                  \
+        libsee_module_depth--;                                             \
+    } while (0)
+
+#define libsee_module_assign_cycles(result, cycles, function_name, ...)                         \
+    do {                                                                                        \
+        libsee_resolve_lazily(function_name);                                                   \
+        if (libsee_module_depth++) result = libsee_apis.function_name(__VA_ARGS__), cycles = 0; \
+        else libsee_assign_cycles(result, cycles, function_name, __VA_ARGS__);                  \
+        libsee_module_depth--;                                                                  \
+    } while (0)
+
+#define libsee_module_noreturn_cycles(cycles, function_name, ...)                      \
+    do {                                                                               \
+        libsee_resolve_lazily(function_name);                                          \
+        if (libsee_module_depth++) libsee_apis.function_name(__VA_ARGS__), cycles = 0; \
+        else libsee_noreturn_cycles(cycles, function_name, __VA_ARGS__);               \
+        libsee_module_depth--;                                                         \
+    } while (0)
+
+#endif // LIBSEE_PCRE2 || LIBSEE_BLAS || LIBSEE_ZLIB
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+#if defined(__GNUC__)
+#define libsee_export __attribute__((dllexport))
+#else
+#define libsee_export __declspec(dllexport)
+#endif
+#else
+#if __GNUC__ >= 4
+#define libsee_export __attribute__((visibility("default")))
+#else
+#define libsee_export
+#endif
+#endif
+
+#pragma endregion
+
+#pragma region Strings // Contents of `string.h`
+
+/** copies one string to another
+ *  https://en.cppreference.com/w/c/string/byte/strcpy
+ */
+libsee_export char *strcpy(char *dest, char const *src) { libsee_return(strcpy, char *, dest, src); }
+libsee_export errno_t strcpy_s(char *dest, rsize_t destsz, char const *src) {
+    libsee_return(strcpy_s, errno_t, dest, destsz, src);
 }
 
 /** copies a certain amount of characters from one string to another
@@ -801,572 +2377,5912 @@ libsee_export void *memrchr(void const *s, int c, size_t n) { libsee_return(memr
 
 #include <wchar.h>
 
-libsee_export size_t wcstombs(char *dst, wchar_t const *src, size_t len) {
-    libsee_return(wcstombs, size_t, dst, src, len);
-}
-
-libsee_export int wcwidth(wchar_t c) { libsee_return(wcwidth, int, c); }
-
-libsee_export int wcswidth(wchar_t const *s, size_t n) { libsee_return(wcswidth, int, s, n); }
+/*
+ *  Conversions between multibyte and wide strings report the number of bytes on the multibyte side,
+ *  so that their cost per byte can be compared to the narrow string functions.
+ *  GLibC has dedicated fast paths for UTF-8, so the calls made under any other codeset are counted separately.
+ */
+typedef union multibyte_calls {
+    struct {
+        size_t wcstombs;
+        size_t mbrtowc;
+        size_t mbstowcs;
+        size_t wcrtomb;
+        size_t wcsrtombs;
+        size_t mbrlen;
+        size_t mbsrtowcs;
+        size_t btowc;
+    } named;
 
-#pragma endregion
+    size_t indexed[8];
+} multibyte_calls;
 
-#pragma region Numerics // Contents of `stdlib.h`
+static multibyte_calls libsee_non_utf8_calls = {0};
 
-libsee_export void srand(unsigned seed) { libsee_noreturn(srand, seed); }
-libsee_export int rand(void) { libsee_return(rand, int); }
+int libsee_is_utf8_locale(void) {
+    libsee_initialize_if_not();
+    char const *codeset = libsee_apis.nl_langinfo(CODESET);
+    char const *expected = "UTF-8";
+    while (*expected && *codeset == *expected) codeset++, expected++;
+    return *expected == 0 && *codeset == 0;
+}
 
-/** common math functions
- *  https://en.cppreference.com/w/c/numeric/math
- */
+#define libsee_count_non_utf8(function_name)                                                          \
+    do {                                                                                              \
+        if (!libsee_is_utf8_locale())                                                                 \
+            __atomic_fetch_add(&libsee_non_utf8_calls.named.function_name, 1, __ATOMIC_RELAXED);      \
+    } while (0)
 
-/** type-generic functions
- *  https://en.cppreference.com/w/c/numeric/tgmath
+/** converts a wide string to narrow multibyte character string
+ *  https://en.cppreference.com/w/c/string/multibyte/wcstombs
  */
+libsee_export size_t wcstombs(char *dst, wchar_t const *src, size_t len) {
+    size_t result;
+    libsee_count_non_utf8(wcstombs);
+    libsee_assign(result, wcstombs, dst, src, len);
+    if (result != (size_t)-1) libsee_add_bytes(wcstombs, result);
+    return result;
+}
 
-#pragma endregion
+libsee_export int wcwidth(wchar_t c) { libsee_return(wcwidth, int, c); }
 
-#pragma region Input / Output // Contents of `stdio.h`
+libsee_export int wcswidth(wchar_t const *s, size_t n) { libsee_return(wcswidth, int, s, n); }
 
-#include <stdarg.h> // `va_start`
+/*
+ *  The functions with explicit lengths or returned lengths report the number of processed bytes,
+ *  which is `sizeof(wchar_t)` times the number of characters they had to scan. For the others,
+ *  the scanned length is derived from the results outside of the timed call.
+ */
 
-/** opens a file
- *  https://en.cppreference.com/w/c/io/fopen
+/**
+ *  @brief  Counts the characters a comparison has to scan: the equal prefix and the first mismatch
+ *          or the terminating null character, but no more than `count`.
  */
-libsee_export FILE *fopen(const char *filename, char const *mode) { libsee_return(fopen, FILE *, filename, mode); }
+size_t libsee_wide_compared_length(wchar_t const *lhs, wchar_t const *rhs, size_t count) {
+    size_t scanned = 0;
+    while (scanned != count && lhs[scanned] == rhs[scanned] && lhs[scanned]) ++scanned;
+    return scanned != count ? scanned + 1 : count;
+}
 
-/** reopens a file stream with a different file or mode
- *  https://en.cppreference.com/w/c/io/freopen
+/** returns the length of a wide string
+ *  https://en.cppreference.com/w/c/string/wide/wcslen
  */
-libsee_export FILE *freopen(char const *filename, char const *mode, FILE *stream) {
-    libsee_return(freopen, FILE *, filename, mode, stream);
+libsee_export size_t wcslen(wchar_t const *str) { libsee_return_bytes(wcslen, size_t, _result * sizeof(wchar_t), str); }
+libsee_export size_t wcsnlen(wchar_t const *str, size_t max) {
+    libsee_return_bytes(wcsnlen, size_t, _result * sizeof(wchar_t), str, max);
 }
 
-/** closes a file
- *  https://en.cppreference.com/w/c/io/fclose
+/** compares two wide strings
+ *  https://en.cppreference.com/w/c/string/wide/wcscmp
  */
-libsee_export int fclose(FILE *stream) { libsee_return(fclose, int, stream); }
+libsee_export int wcscmp(wchar_t const *lhs, wchar_t const *rhs) {
+    libsee_return_bytes(wcscmp, int, libsee_wide_compared_length(lhs, rhs, (size_t)-1) * sizeof(wchar_t), lhs, rhs);
+}
 
-/** synchronizes an output stream with the actual file
- *  https://en.cppreference.com/w/c/io/fflush
+/** compares a certain amount of characters from two wide strings
+ *  https://en.cppreference.com/w/c/string/wide/wcsncmp
  */
-libsee_export int fflush(FILE *stream) { libsee_return(fflush, int, stream); }
+libsee_export int wcsncmp(wchar_t const *lhs, wchar_t const *rhs, size_t count) {
+    libsee_return_bytes(
+        wcsncmp, int, libsee_wide_compared_length(lhs, rhs, count) * sizeof(wchar_t), lhs, rhs, count);
+}
 
-/** sets the buffer for a file stream
- *  https://en.cppreference.com/w/c/io/setbuf
+/** copies one wide string to another
+ *  https://en.cppreference.com/w/c/string/wide/wcscpy
  */
-libsee_export void setbuf(FILE *stream, char *buf) { libsee_noreturn(setbuf, stream, buf); }
+libsee_export wchar_t *wcscpy(wchar_t *dest, wchar_t const *src) {
+    libsee_return_bytes(wcscpy, wchar_t *, (libsee_apis.wcslen(dest) + 1) * sizeof(wchar_t), dest, src);
+}
 
-/** sets the buffer and its size for a file stream
- *  https://en.cppreference.com/w/c/io/setvbuf
- *
- *  The setvbuf function may be used to specify the buffering for stream.
+/** copies a certain amount of wide characters from one string to another
+ *  https://en.cppreference.com/w/c/string/wide/wcsncpy
  */
-libsee_export int setvbuf(FILE *stream, char *buf, int mode, size_t size) {
-    libsee_return(setvbuf, int, stream, buf, mode, size);
+libsee_export wchar_t *wcsncpy(wchar_t *dest, wchar_t const *src, size_t count) {
+    libsee_return_bytes(wcsncpy, wchar_t *, count * sizeof(wchar_t), dest, src, count);
 }
 
-/** reads from a file
- *  https://en.cppreference.com/w/c/io/fread
+/** appends a copy of one wide string to another
+ *  https://en.cppreference.com/w/c/string/wide/wcscat
  */
-libsee_export size_t fread(void *ptr, size_t size, size_t nmemb, FILE *stream) {
-    libsee_return(fread, size_t, ptr, size, nmemb, stream);
+libsee_export wchar_t *wcscat(wchar_t *dest, wchar_t const *src) {
+    // Both the destination and the appended string are scanned, so the whole result is counted
+    libsee_return_bytes(wcscat, wchar_t *, (libsee_apis.wcslen(dest) + 1) * sizeof(wchar_t), dest, src);
 }
 
-/** writes to a file
- *  https://en.cppreference.com/w/c/io/fwrite
+/** finds the first occurrence of a wide character in a wide string
+ *  https://en.cppreference.com/w/c/string/wide/wcschr
  */
-libsee_export size_t fwrite(void const *ptr, size_t size, size_t nmemb, FILE *stream) {
-    libsee_return(fwrite, size_t, ptr, size, nmemb, stream);
+libsee_export wchar_t *wcschr(wchar_t const *str, wchar_t ch) {
+    libsee_return_bytes(wcschr, wchar_t *,
+        (_result ? (size_t)(_result - str) + 1 : libsee_apis.wcslen(str) + 1) * sizeof(wchar_t), str, ch);
 }
 
-/** moves the file position indicator to a specific location in a file
- *  https://en.cppreference.com/w/c/io/fseek
+/** finds the last occurrence of a wide character in a wide string
+ *  https://en.cppreference.com/w/c/string/wide/wcsrchr
  */
-libsee_export int fseek(FILE *stream, long offset, int whence) { libsee_return(fseek, int, stream, offset, whence); }
+libsee_export wchar_t *wcsrchr(wchar_t const *str, wchar_t ch) {
+    libsee_return_bytes(wcsrchr, wchar_t *, (libsee_apis.wcslen(str) + 1) * sizeof(wchar_t), str, ch);
+}
 
-/** returns the current file position indicator
- *  https://en.cppreference.com/w/c/io/ftell
+/** finds the first occurrence of a wide string within another wide string
+ *  https://en.cppreference.com/w/c/string/wide/wcsstr
  */
-libsee_export long ftell(FILE *stream) { libsee_return(ftell, long, stream); }
+libsee_export wchar_t *wcsstr(wchar_t const *haystack, wchar_t const *needle) {
+    libsee_return_bytes(wcsstr, wchar_t *,
+        (_result ? (size_t)(_result - haystack) + libsee_apis.wcslen(needle) : libsee_apis.wcslen(haystack)) *
+            sizeof(wchar_t),
+        haystack, needle);
+}
 
-/** sets the file position of the given stream to the given position
- *  https://en.cppreference.com/w/c/io/fsetpos
+/** finds the next token in a wide string
+ *  https://en.cppreference.com/w/c/string/wide/wcstok
  */
-libsee_export int fsetpos(FILE *stream, fpos_t const *pos) { libsee_return(fsetpos, int, stream, pos); }
+libsee_export wchar_t *wcstok(wchar_t *str, wchar_t const *delim, wchar_t **ptr) {
+    // The scanned range ends at the saved position, or, after the last token, at the end of the string
+    wchar_t const *start = str ? str : *ptr;
+    wchar_t *result;
+    libsee_assign(result, wcstok, str, delim, ptr);
+    wchar_t const *end = *ptr ? *ptr : result ? result + libsee_apis.wcslen(result) : start;
+    libsee_add_bytes(wcstok, start ? (size_t)(end - start) * sizeof(wchar_t) : 0);
+    return result;
+}
 
-/** gets the file position indicator
- *  https://en.cppreference.com/w/c/io/fgetpos
+/** copies a certain amount of wide characters between two non-overlapping arrays
+ *  https://en.cppreference.com/w/c/string/wide/wmemcpy
  */
-libsee_export int fgetpos(FILE *stream, fpos_t *pos) { libsee_return(fgetpos, int, stream, pos); }
+libsee_export wchar_t *wmemcpy(wchar_t *dest, wchar_t const *src, size_t count) {
+    libsee_return_bytes(wmemcpy, wchar_t *, count * sizeof(wchar_t), dest, src, count);
+}
 
-/** moves the file position indicator to the beginning of a file
- *  https://en.cppreference.com/w/c/io/rewind
+/** copies a certain amount of wide characters between two, possibly overlapping, arrays
+ *  https://en.cppreference.com/w/c/string/wide/wmemmove
  */
-libsee_export void rewind(FILE *stream) { libsee_noreturn(rewind, stream); }
+libsee_export wchar_t *wmemmove(wchar_t *dest, wchar_t const *src, size_t count) {
+    libsee_return_bytes(wmemmove, wchar_t *, count * sizeof(wchar_t), dest, src, count);
+}
 
-/** clears errors
- *  https://en.cppreference.com/w/c/io/clearerr
+/** copies the given wide character to every position in a wide character array
+ *  https://en.cppreference.com/w/c/string/wide/wmemset
  */
-libsee_export void clearerr(FILE *stream) { libsee_noreturn(clearerr, stream); }
+libsee_export wchar_t *wmemset(wchar_t *dest, wchar_t ch, size_t count) {
+    libsee_return_bytes(wmemset, wchar_t *, count * sizeof(wchar_t), dest, ch, count);
+}
 
-/** checks for the end-of-file
- *  https://en.cppreference.com/w/c/io/feof
+/** compares a certain amount of wide characters from two arrays
+ *  https://en.cppreference.com/w/c/string/wide/wmemcmp
  */
-libsee_export int feof(FILE *stream) { libsee_return(feof, int, stream); }
+libsee_export int wmemcmp(wchar_t const *lhs, wchar_t const *rhs, size_t count) {
+    int result;
+    libsee_assign(result, wmemcmp, lhs, rhs, count);
+    // Comparison stops at the first mismatch, found again outside of the timed call
+    size_t scanned = count;
+    if (result != 0) {
+        scanned = 0;
+        while (lhs[scanned] == rhs[scanned]) ++scanned;
+        ++scanned;
+    }
+    libsee_add_bytes(wmemcmp, scanned * sizeof(wchar_t));
+    return result;
+}
 
-/** checks for a file error
- *  https://en.cppreference.com/w/c/io/ferror
+/** finds the first occurrence of a wide character in a wide character array
+ *  https://en.cppreference.com/w/c/string/wide/wmemchr
  */
-libsee_export int ferror(FILE *stream) { libsee_return(ferror, int, stream); }
+libsee_export wchar_t *wmemchr(wchar_t const *str, wchar_t ch, size_t count) {
+    libsee_return_bytes(wmemchr, wchar_t *, (_result ? (size_t)(_result - str + 1) : count) * sizeof(wchar_t), str, ch,
+        count);
+}
 
-/** displays a character string corresponding of the current error to stderr
- *  https://en.cppreference.com/w/c/io/perror
+/** compares two wide strings in accordance to the current locale
+ *  https://en.cppreference.com/w/c/string/wide/wcscoll
  */
-libsee_export void perror(char const *s) { libsee_noreturn(perror, s); }
+libsee_export int wcscoll(wchar_t const *lhs, wchar_t const *rhs) {
+    // Collation weighs the strings as a whole, unlike the plain comparison stopping at the first mismatch
+    libsee_return_bytes(
+        wcscoll, int, (libsee_apis.wcslen(lhs) + libsee_apis.wcslen(rhs) + 2) * sizeof(wchar_t), lhs, rhs);
+}
 
-/** reads formatted input from stdin
- *  https://en.cppreference.com/w/c/io/fscanf
+/** transform a wide string so that wcscmp would produce the same result as wcscoll
+ *  https://en.cppreference.com/w/c/string/wide/wcsxfrm
  */
-libsee_export int scanf(char const *format, ...) {
-    va_list args;
-    int result;
-    va_start(args, format);
-    libsee_assign(result, vscanf, format, args);
-    va_end(args);
-    return result;
+libsee_export size_t wcsxfrm(wchar_t *dest, wchar_t const *src, size_t count) {
+    libsee_return_bytes(wcsxfrm, size_t, _result * sizeof(wchar_t), dest, src, count);
 }
 
-libsee_export int fscanf(FILE *stream, char const *format, ...) {
-    va_list args;
-    int result;
-    va_start(args, format);
-    libsee_assign(result, vfscanf, stream, format, args);
-    va_end(args);
+/** converts the next multibyte character to wide character, given state
+ *  https://en.cppreference.com/w/c/string/multibyte/mbrtowc
+ */
+libsee_export size_t mbrtowc(wchar_t *pwc, char const *s, size_t n, mbstate_t *ps) {
+    size_t result;
+    libsee_count_non_utf8(mbrtowc);
+    libsee_assign(result, mbrtowc, pwc, s, n, ps);
+    // Zero stands for the null character, and `(size_t)-2` for an incomplete sequence stored into `ps`
+    if (s && result == 0) libsee_add_bytes(mbrtowc, 1);
+    else if (s && result == (size_t)-2) libsee_add_bytes(mbrtowc, n);
+    else if (s && result != (size_t)-1) libsee_add_bytes(mbrtowc, result);
     return result;
 }
 
-libsee_export int sscanf(char const *str, char const *format, ...) {
-    va_list args;
-    int result;
-    va_start(args, format);
-    libsee_assign(result, vsscanf, str, format, args);
-    va_end(args);
+/** returns the number of bytes in the next multibyte character, given state
+ *  https://en.cppreference.com/w/c/string/multibyte/mbrlen
+ */
+libsee_export size_t mbrlen(char const *s, size_t n, mbstate_t *ps) {
+    size_t result;
+    libsee_count_non_utf8(mbrlen);
+    libsee_assign(result, mbrlen, s, n, ps);
+    if (s && result == 0) libsee_add_bytes(mbrlen, 1);
+    else if (s && result == (size_t)-2) libsee_add_bytes(mbrlen, n);
+    else if (s && result != (size_t)-1) libsee_add_bytes(mbrlen, result);
     return result;
 }
 
-/** reads formatted input from stdin
- *  https://en.cppreference.com/w/c/io/vscanf
+/** converts a wide character to its multibyte representation, given state
+ *  https://en.cppreference.com/w/c/string/multibyte/wcrtomb
  */
-libsee_export int vscanf(char const *format, va_list vlist) { libsee_return(vscanf, int, format, vlist); }
-
-libsee_export int vfscanf(FILE *stream, char const *format, va_list vlist) {
-    libsee_return(vfscanf, int, stream, format, vlist);
+libsee_export size_t wcrtomb(char *s, wchar_t wc, mbstate_t *ps) {
+    size_t result;
+    libsee_count_non_utf8(wcrtomb);
+    libsee_assign(result, wcrtomb, s, wc, ps);
+    if (s && result != (size_t)-1) libsee_add_bytes(wcrtomb, result);
+    return result;
 }
 
-libsee_export int vsscanf(char const *str, char const *format, va_list vlist) {
-    libsee_return(vsscanf, int, str, format, vlist);
+/** widens a single-byte narrow character to wide character, if possible
+ *  https://en.cppreference.com/w/c/string/multibyte/btowc
+ */
+libsee_export wint_t btowc(int c) {
+    wint_t result;
+    libsee_count_non_utf8(btowc);
+    libsee_assign(result, btowc, c);
+    if (result != WEOF) libsee_add_bytes(btowc, 1);
+    return result;
 }
 
-/** prints formatted output to stdout
- *  https://en.cppreference.com/w/c/io/fprintf
+/** converts a narrow multibyte character string to wide string
+ *  https://en.cppreference.com/w/c/string/multibyte/mbstowcs
+ *
+ *  Only the number of produced wide characters is known, so the consumed bytes are counted
+ *  as the length of the source, unless the destination is full, where one byte per character is assumed.
  */
-libsee_export int printf(char const *format, ...) {
-    int result;
-    va_list args;
-    va_start(args, format);
-    libsee_assign(result, vprintf, format, args);
-    va_end(args);
+libsee_export size_t mbstowcs(wchar_t *dst, char const *src, size_t len) {
+    size_t result;
+    libsee_count_non_utf8(mbstowcs);
+    libsee_assign(result, mbstowcs, dst, src, len);
+    if (result == (size_t)-1) return result;
+    libsee_add_bytes(mbstowcs, !dst || result < len ? libsee_apis.strlen(src) : result);
     return result;
 }
 
-libsee_export int fprintf(FILE *stream, char const *format, ...) {
-    int result;
-    va_list args;
-    va_start(args, format);
-    libsee_assign(result, vfprintf, stream, format, args);
-    va_end(args);
+/** converts a narrow multibyte character string to wide string, given state
+ *  https://en.cppreference.com/w/c/string/multibyte/mbsrtowcs
+ */
+libsee_export size_t mbsrtowcs(wchar_t *dst, char const **src, size_t len, mbstate_t *ps) {
+    size_t result;
+    char const *start = *src;
+    libsee_count_non_utf8(mbsrtowcs);
+    libsee_assign(result, mbsrtowcs, dst, src, len, ps);
+    if (result == (size_t)-1) return result;
+    // The source pointer is only advanced with a destination, and is reset to NULL at the terminator
+    libsee_add_bytes(mbsrtowcs, dst && *src ? (size_t)(*src - start) : libsee_apis.strlen(start));
     return result;
 }
 
-#undef sprintf  // For MacOS
-#undef vsprintf // For MacOS
-libsee_export int sprintf(char *str, char const *format, ...) {
-    int result;
-    va_list args;
-    va_start(args, format);
-    libsee_assign(result, vsprintf, str, format, args);
-    va_end(args);
+/** converts a wide string to narrow multibyte character string, given state
+ *  https://en.cppreference.com/w/c/string/multibyte/wcsrtombs
+ */
+libsee_export size_t wcsrtombs(char *dst, wchar_t const **src, size_t len, mbstate_t *ps) {
+    size_t result;
+    libsee_count_non_utf8(wcsrtombs);
+    libsee_assign(result, wcsrtombs, dst, src, len, ps);
+    if (result != (size_t)-1) libsee_add_bytes(wcsrtombs, result);
     return result;
 }
 
-#undef snprintf  // For MacOS
-#undef vsnprintf // For MacOS
-libsee_export int snprintf(char *str, size_t size, char const *format, ...) {
-    int result;
-    va_list args;
-    va_start(args, format);
-    libsee_assign(result, vsnprintf, str, size, format, args);
-    va_end(args);
+/** converts between arbitrary character encodings, counting the consumed input bytes
+ *  https://man7.org/linux/man-pages/man3/iconv.3.html
+ */
+libsee_export size_t iconv(iconv_t cd, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+    size_t result;
+    size_t input_bytes = inbuf && *inbuf && inbytesleft ? *inbytesleft : 0;
+    libsee_assign(result, iconv, cd, inbuf, inbytesleft, outbuf, outbytesleft);
+    if (input_bytes) libsee_add_bytes(iconv, input_bytes - *inbytesleft);
     return result;
 }
 
-/** prints formatted output to stdout
- *  https://en.cppreference.com/w/c/io/fprintf
+#pragma endregion
+
+#pragma region Numerics // Contents of `stdlib.h`
+
+/** pseudo-random number generators
+ *  https://en.cppreference.com/w/c/numeric/random
+ *  https://man7.org/linux/man-pages/man3/random.3.html
+ *  https://man7.org/linux/man-pages/man3/drand48.3.html
+ *
+ *  The `rand` and `random` families share a single state guarded by a process-wide lock, while the
+ *  `drand48` family shares an unguarded state, bouncing its cache line between the cores. Both are
+ *  tracked per thread, to flag the generators shared by many threads. The reentrant variants and
+ *  the `arc4random` family keep their state per caller or per thread, so only their costs are counted.
  */
-libsee_export int vprintf(char const *format, va_list vlist) { libsee_return(vprintf, int, format, vlist); }
+#define libsee_shared_generator(function_name, return_type, ...)            \
+    do {                                                                    \
+        return_type _result;                                                \
+        size_t _cycles;                                                     \
+        libsee_assign_cycles(_result, _cycles, function_name, __VA_ARGS__); \
+        libsee_track_thread(function_name, _cycles);                        \
+        return _result;                                                     \
+    } while (0)
+#define libsee_shared_seeding(function_name, ...)                    \
+    do {                                                             \
+        size_t _cycles;                                              \
+        libsee_noreturn_cycles(_cycles, function_name, __VA_ARGS__); \
+        libsee_track_thread(function_name, _cycles);                 \
+    } while (0)
 
-libsee_export int vfprintf(FILE *stream, char const *format, va_list vlist) {
-    libsee_return(vfprintf, int, stream, format, vlist);
+libsee_export void srand(unsigned seed) { libsee_shared_seeding(srand, seed); }
+libsee_export int rand(void) { libsee_shared_generator(rand, int); }
+libsee_export void srandom(unsigned seed) { libsee_shared_seeding(srandom, seed); }
+libsee_export long random(void) { libsee_shared_generator(random, long); }
+libsee_export int rand_r(unsigned *seed) { libsee_return(rand_r, int, seed); }
+libsee_export int random_r(struct random_data *state, int32_t *result) {
+    libsee_return(random_r, int, state, result);
 }
 
-libsee_export int vsprintf(char *str, char const *format, va_list vlist) {
-    libsee_return(vsprintf, int, str, format, vlist);
+libsee_export double drand48(void) { libsee_shared_generator(drand48, double); }
+libsee_export double erand48(unsigned short state[3]) { libsee_return(erand48, double, state); }
+libsee_export long lrand48(void) { libsee_shared_generator(lrand48, long); }
+libsee_export long nrand48(unsigned short state[3]) { libsee_return(nrand48, long, state); }
+libsee_export long mrand48(void) { libsee_shared_generator(mrand48, long); }
+libsee_export long jrand48(unsigned short state[3]) { libsee_return(jrand48, long, state); }
+libsee_export void srand48(long seed) { libsee_shared_seeding(srand48, seed); }
+libsee_export unsigned short *seed48(unsigned short seed[3]) {
+    libsee_shared_generator(seed48, unsigned short *, seed);
 }
+libsee_export void lcong48(unsigned short parameters[7]) { libsee_shared_seeding(lcong48, parameters); }
 
-libsee_export int vsnprintf(char *str, size_t size, char const *format, va_list vlist) {
-    libsee_return(vsnprintf, int, str, size, format, vlist);
+/** cryptographically-secure random numbers
+ *  https://man7.org/linux/man-pages/man3/arc4random.3.html
+ *  https://man7.org/linux/man-pages/man2/getrandom.2.html
+ */
+libsee_export uint32_t arc4random(void) { libsee_return(arc4random, uint32_t); }
+libsee_export void arc4random_buf(void *buffer, size_t length) {
+    libsee_noreturn(arc4random_buf, buffer, length);
+    libsee_add_bytes(arc4random_buf, length);
+}
+libsee_export uint32_t arc4random_uniform(uint32_t upper_bound) {
+    libsee_return(arc4random_uniform, uint32_t, upper_bound);
+}
+libsee_export ssize_t getrandom(void *buffer, size_t length, unsigned int flags) {
+    libsee_return_bytes(getrandom, ssize_t, _result > 0 ? (size_t)_result : 0, buffer, length, flags);
 }
 
-#pragma endregion
+/** common math functions
+ *  https://en.cppreference.com/w/c/numeric/math
+ *
+ *  LibM implementations have fast paths for "reasonable" arguments and fall back to much slower
+ *  code for denormals, NaNs, infinities, and huge arguments of trigonometric functions.
+ *  So besides timing, every floating-point argument is classified and its binary exponent is recorded.
+ */
 
-#pragma region Date and Time // Contents of `time.h`
+#include <math.h> // `FP_NAN`, `FP_SUBNORMAL`
 
-/** computes the difference between times
- *  https://en.cppreference.com/w/c/chrono/difftime
+/*
+ *  Magnitudes of finite non-zero arguments are bucketed by their binary exponent `e`, where `2^e <= |x| < 2^(e+1)`.
+ *  The first bucket collects everything below `2^-32`, and the last one everything at or above `2^32`.
  */
-libsee_export double difftime(time_t end, time_t beginning) { libsee_return(difftime, double, end, beginning); }
+#define LIBSEE_MATH_MAGNITUDE_BUCKETS 66
+#define LIBSEE_MATH_MIN_EXPONENT (-32)
 
-/** returns the current calendar time of the system as time since epoch
- *  https://en.cppreference.com/w/c/chrono/time
- */
-libsee_export time_t time(time_t *arg) { libsee_return(time, time_t, arg); }
+typedef struct libsee_math_stats {
+    size_t magnitudes[LIBSEE_MATH_MAGNITUDE_BUCKETS];
+    size_t zeros;
+    size_t denormals;
+    size_t nans;
+    size_t infinities;
+} libsee_math_stats;
 
-/** returns raw processor clock time since the program is started
- *  https://en.cppreference.com/w/c/chrono/clock
- */
-libsee_export clock_t clock(void) { libsee_return(clock, clock_t); }
+#define LIBSEE_MATH_FUNCTIONS 27
 
-/** returns the calendar time in seconds and nanoseconds based on a given time base
- *  https://en.cppreference.com/w/c/chrono/timespec_get
- */
-libsee_export int timespec_get(struct timespec *ts, int base) { libsee_return(timespec_get, int, ts, base); }
+typedef union math_input_stats {
+    struct {
+        libsee_math_stats exp;
+        libsee_math_stats expf;
+        libsee_math_stats expl;
+        libsee_math_stats log;
+        libsee_math_stats logf;
+        libsee_math_stats logl;
+        libsee_math_stats pow;
+        libsee_math_stats powf;
+        libsee_math_stats powl;
+        libsee_math_stats sin;
+        libsee_math_stats sinf;
+        libsee_math_stats sinl;
+        libsee_math_stats cos;
+        libsee_math_stats cosf;
+        libsee_math_stats cosl;
+        libsee_math_stats sqrt;
+        libsee_math_stats sqrtf;
+        libsee_math_stats sqrtl;
+        libsee_math_stats fmod;
+        libsee_math_stats fmodf;
+        libsee_math_stats fmodl;
+        libsee_math_stats erf;
+        libsee_math_stats erff;
+        libsee_math_stats erfl;
+        libsee_math_stats lgamma;
+        libsee_math_stats lgammaf;
+        libsee_math_stats lgammal;
+    } named;
 
-/** returns the resolution of calendar time based on a given time base
- *  https://en.cppreference.com/w/c/chrono/timespec_getres
- */
-libsee_export int timespec_getres(struct timespec *res, int base) { libsee_return(timespec_getres, int, res, base); }
+    libsee_math_stats indexed[LIBSEE_MATH_FUNCTIONS];
+} math_input_stats;
 
-/** converts a tm object to a textual representation
- *  https://en.cppreference.com/w/c/chrono/asctime
- */
-libsee_export char *asctime(struct tm const *time_ptr) { libsee_return(asctime, char *, time_ptr); }
-libsee_export errno_t asctime_s(char *buf, rsize_t bufsz, struct tm const *time_ptr) {
-    libsee_return(asctime_s, errno_t, buf, bufsz, time_ptr);
+static math_input_stats libsee_math_inputs = {0};
+
+void libsee_math_record(libsee_math_stats *stats, int fp_class, double value) {
+    switch (fp_class) {
+    case FP_ZERO: __atomic_fetch_add(&stats->zeros, 1, __ATOMIC_RELAXED); return;
+    case FP_NAN: __atomic_fetch_add(&stats->nans, 1, __ATOMIC_RELAXED); return;
+    case FP_INFINITE: __atomic_fetch_add(&stats->infinities, 1, __ATOMIC_RELAXED); return;
+    case FP_SUBNORMAL: __atomic_fetch_add(&stats->denormals, 1, __ATOMIC_RELAXED); break;
+    default: break;
+    }
+
+    // Extract the exponent directly from the IEEE 754 representation, as `frexp` lives in LibM.
+    union {
+        double value;
+        unsigned long long bits;
+    } representation;
+    representation.value = value;
+    long exponent = (long)((representation.bits >> 52) & 0x7FF) - 1023;
+    long bucket = exponent - LIBSEE_MATH_MIN_EXPONENT + 1;
+    if (bucket < 0) bucket = 0;
+    if (bucket >= LIBSEE_MATH_MAGNITUDE_BUCKETS) bucket = LIBSEE_MATH_MAGNITUDE_BUCKETS - 1;
+    __atomic_fetch_add(&stats->magnitudes[bucket], 1, __ATOMIC_RELAXED);
 }
 
-/** converts a time_t object to a textual representation
- *  https://en.cppreference.com/w/c/chrono/ctime
+// Classification must happen in the native precision, as a `float` denormal is a normal `double`.
+void libsee_math_record_float(libsee_math_stats *stats, float value) {
+    libsee_math_record(stats, __builtin_fpclassify(FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, value),
+        (double)value);
+}
+void libsee_math_record_double(libsee_math_stats *stats, double value) {
+    libsee_math_record(stats, __builtin_fpclassify(FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, value),
+        value);
+}
+void libsee_math_record_long(libsee_math_stats *stats, long double value) {
+    libsee_math_record(stats, __builtin_fpclassify(FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, value),
+        (double)value);
+}
+
+/** computes e raised to the given power
+ *  https://en.cppreference.com/w/c/numeric/math/exp
  */
-libsee_export char *ctime(time_t const *clock) { libsee_return(ctime, char *, clock); }
-libsee_export errno_t ctime_s(char *buf, rsize_t bufsz, time_t const *clock) {
-    libsee_return(ctime_s, errno_t, buf, bufsz, clock);
+libsee_export double exp(double x) {
+    libsee_math_record_double(&libsee_math_inputs.named.exp, x);
+    libsee_resolve_lazily(exp);
+    libsee_return(exp, double, x);
+}
+libsee_export float expf(float x) {
+    libsee_math_record_float(&libsee_math_inputs.named.expf, x);
+    libsee_resolve_lazily(expf);
+    libsee_return(expf, float, x);
+}
+libsee_export long double expl(long double x) {
+    libsee_math_record_long(&libsee_math_inputs.named.expl, x);
+    libsee_resolve_lazily(expl);
+    libsee_return(expl, long double, x);
 }
 
-/** converts a tm object to custom textual representation
- *  https://en.cppreference.com/w/c/chrono/strftime
+/** computes natural (base e) logarithm
+ *  https://en.cppreference.com/w/c/numeric/math/log
  */
-libsee_export size_t strftime(char *s, size_t maxsize, char const *format, struct tm const *timeptr) {
-    libsee_return(strftime, size_t, s, maxsize, format, timeptr);
+libsee_export double log(double x) {
+    libsee_math_record_double(&libsee_math_inputs.named.log, x);
+    libsee_resolve_lazily(log);
+    libsee_return(log, double, x);
+}
+libsee_export float logf(float x) {
+    libsee_math_record_float(&libsee_math_inputs.named.logf, x);
+    libsee_resolve_lazily(logf);
+    libsee_return(logf, float, x);
+}
+libsee_export long double logl(long double x) {
+    libsee_math_record_long(&libsee_math_inputs.named.logl, x);
+    libsee_resolve_lazily(logl);
+    libsee_return(logl, long double, x);
 }
 
-/** converts a tm object to custom wide string textual representation
- *  https://en.cppreference.com/w/c/chrono/wcsftime
+/** raises a number to the given power
+ *  https://en.cppreference.com/w/c/numeric/math/pow
  */
-libsee_export size_t wcsftime(wchar_t *wcs, size_t maxsize, wchar_t const *format, struct tm const *timeptr) {
-    libsee_return(wcsftime, size_t, wcs, maxsize, format, timeptr);
+libsee_export double pow(double x, double y) {
+    libsee_math_record_double(&libsee_math_inputs.named.pow, x);
+    libsee_math_record_double(&libsee_math_inputs.named.pow, y);
+    libsee_resolve_lazily(pow);
+    libsee_return(pow, double, x, y);
+}
+libsee_export float powf(float x, float y) {
+    libsee_math_record_float(&libsee_math_inputs.named.powf, x);
+    libsee_math_record_float(&libsee_math_inputs.named.powf, y);
+    libsee_resolve_lazily(powf);
+    libsee_return(powf, float, x, y);
+}
+libsee_export long double powl(long double x, long double y) {
+    libsee_math_record_long(&libsee_math_inputs.named.powl, x);
+    libsee_math_record_long(&libsee_math_inputs.named.powl, y);
+    libsee_resolve_lazily(powl);
+    libsee_return(powl, long double, x, y);
 }
 
-/** converts time since epoch to calendar time expressed as Coordinated Universal Time (UTC)
- *  https://en.cppreference.com/w/c/chrono/gmtime
+/** computes sine
+ *  https://en.cppreference.com/w/c/numeric/math/sin
  */
-libsee_export struct tm *gmtime(time_t const *timer) { libsee_return(gmtime, struct tm *, timer); }
-libsee_export struct tm *gmtime_r(time_t const *timer, struct tm *result) {
-    libsee_return(gmtime_r, struct tm *, timer, result);
+libsee_export double sin(double x) {
+    libsee_math_record_double(&libsee_math_inputs.named.sin, x);
+    libsee_resolve_lazily(sin);
+    libsee_return(sin, double, x);
 }
-libsee_export errno_t gmtime_s(time_t const *timer, struct tm *result) {
-    libsee_return(gmtime_s, errno_t, timer, result);
+libsee_export float sinf(float x) {
+    libsee_math_record_float(&libsee_math_inputs.named.sinf, x);
+    libsee_resolve_lazily(sinf);
+    libsee_return(sinf, float, x);
+}
+libsee_export long double sinl(long double x) {
+    libsee_math_record_long(&libsee_math_inputs.named.sinl, x);
+    libsee_resolve_lazily(sinl);
+    libsee_return(sinl, long double, x);
 }
 
-/** converts time since epoch to calendar time expressed as local time
- *  https://en.cppreference.com/w/c/chrono/localtime
+/** computes cosine
+ *  https://en.cppreference.com/w/c/numeric/math/cos
  */
-libsee_export struct tm *localtime(time_t const *timer) { libsee_return(localtime, struct tm *, timer); }
-libsee_export struct tm *localtime_r(time_t const *timer, struct tm *result) {
-    libsee_return(localtime_r, struct tm *, timer, result);
+libsee_export double cos(double x) {
+    libsee_math_record_double(&libsee_math_inputs.named.cos, x);
+    libsee_resolve_lazily(cos);
+    libsee_return(cos, double, x);
 }
-libsee_export errno_t localtime_s(time_t const *timer, struct tm *result) {
-    libsee_return(localtime_s, errno_t, timer, result);
+libsee_export float cosf(float x) {
+    libsee_math_record_float(&libsee_math_inputs.named.cosf, x);
+    libsee_resolve_lazily(cosf);
+    libsee_return(cosf, float, x);
+}
+libsee_export long double cosl(long double x) {
+    libsee_math_record_long(&libsee_math_inputs.named.cosl, x);
+    libsee_resolve_lazily(cosl);
+    libsee_return(cosl, long double, x);
 }
 
-/** converts calendar time to time since epoch
- *  https://en.cppreference.com/w/c/chrono/mktime
+/** computes square root
+ *  https://en.cppreference.com/w/c/numeric/math/sqrt
+ */
+libsee_export double sqrt(double x) {
+    libsee_math_record_double(&libsee_math_inputs.named.sqrt, x);
+    libsee_resolve_lazily(sqrt);
+    libsee_return(sqrt, double, x);
+}
+libsee_export float sqrtf(float x) {
+    libsee_math_record_float(&libsee_math_inputs.named.sqrtf, x);
+    libsee_resolve_lazily(sqrtf);
+    libsee_return(sqrtf, float, x);
+}
+libsee_export long double sqrtl(long double x) {
+    libsee_math_record_long(&libsee_math_inputs.named.sqrtl, x);
+    libsee_resolve_lazily(sqrtl);
+    libsee_return(sqrtl, long double, x);
+}
+
+/** remainder of the floating point division operation
+ *  https://en.cppreference.com/w/c/numeric/math/fmod
+ */
+libsee_export double fmod(double x, double y) {
+    libsee_math_record_double(&libsee_math_inputs.named.fmod, x);
+    libsee_math_record_double(&libsee_math_inputs.named.fmod, y);
+    libsee_resolve_lazily(fmod);
+    libsee_return(fmod, double, x, y);
+}
+libsee_export float fmodf(float x, float y) {
+    libsee_math_record_float(&libsee_math_inputs.named.fmodf, x);
+    libsee_math_record_float(&libsee_math_inputs.named.fmodf, y);
+    libsee_resolve_lazily(fmodf);
+    libsee_return(fmodf, float, x, y);
+}
+libsee_export long double fmodl(long double x, long double y) {
+    libsee_math_record_long(&libsee_math_inputs.named.fmodl, x);
+    libsee_math_record_long(&libsee_math_inputs.named.fmodl, y);
+    libsee_resolve_lazily(fmodl);
+    libsee_return(fmodl, long double, x, y);
+}
+
+/** error function
+ *  https://en.cppreference.com/w/c/numeric/math/erf
+ */
+libsee_export double erf(double x) {
+    libsee_math_record_double(&libsee_math_inputs.named.erf, x);
+    libsee_resolve_lazily(erf);
+    libsee_return(erf, double, x);
+}
+libsee_export float erff(float x) {
+    libsee_math_record_float(&libsee_math_inputs.named.erff, x);
+    libsee_resolve_lazily(erff);
+    libsee_return(erff, float, x);
+}
+libsee_export long double erfl(long double x) {
+    libsee_math_record_long(&libsee_math_inputs.named.erfl, x);
+    libsee_resolve_lazily(erfl);
+    libsee_return(erfl, long double, x);
+}
+
+/** natural logarithm of the gamma function
+ *  https://en.cppreference.com/w/c/numeric/math/lgamma
+ */
+libsee_export double lgamma(double x) {
+    libsee_math_record_double(&libsee_math_inputs.named.lgamma, x);
+    libsee_resolve_lazily(lgamma);
+    libsee_return(lgamma, double, x);
+}
+libsee_export float lgammaf(float x) {
+    libsee_math_record_float(&libsee_math_inputs.named.lgammaf, x);
+    libsee_resolve_lazily(lgammaf);
+    libsee_return(lgammaf, float, x);
+}
+libsee_export long double lgammal(long double x) {
+    libsee_math_record_long(&libsee_math_inputs.named.lgammal, x);
+    libsee_resolve_lazily(lgammal);
+    libsee_return(lgammal, long double, x);
+}
+
+/** type-generic functions
+ *  https://en.cppreference.com/w/c/numeric/tgmath
  */
-libsee_export time_t mktime(struct tm *timeptr) { libsee_return(mktime, time_t, timeptr); }
 
 #pragma endregion
 
-#pragma region Memory Management // Contents of `stdlib.h`
+#pragma region Numeric Conversions // Contents of `stdlib.h` and `inttypes.h`
 
-/** allocates memory
- *  https://en.cppreference.com/w/c/memory/malloc
+/*
+ *  Parsing functions report the number of characters consumed, as returned through `str_end`,
+ *  so the report shows the cost per character. Formatting functions report the characters produced.
+ *  The `ato*` functions have no `str_end`, so the length of the parsed prefix is re-scanned afterwards.
+ *  Note, that with optimizations enabled GLibC headers inline `atoi`, `atol`, and `atoll` into `strtol`
+ *  and `strtoll` calls, so those will show up under the `strto*` names.
  */
-libsee_export void *malloc(size_t size) { libsee_return(malloc, void *, size); }
-libsee_export void *calloc(size_t num, size_t size) { libsee_return(calloc, void *, num, size); }
-libsee_export void *realloc(void *ptr, size_t size) { libsee_return(realloc, void *, ptr, size); }
 
-/** deallocates memory
- *  https://en.cppreference.com/w/c/memory/free
+/**
+ *  @brief  Returns the length of the longest prefix of `str`, that `strtol` or `strtod` would consume
+ *          in the "C" locale, or zero if no conversion can be performed.
  */
-libsee_export void free(void *ptr) { libsee_noreturn(free, ptr); }
+size_t libsee_numeric_prefix_length(char const *str, int floating) {
+    char const *cursor = str;
+    while (*cursor == ' ' || (*cursor >= '\t' && *cursor <= '\r')) cursor++;
+    if (*cursor == '+' || *cursor == '-') cursor++;
+    if (!floating) {
+        char const *digits = cursor;
+        while (*cursor >= '0' && *cursor <= '9') cursor++;
+        return cursor != digits ? (size_t)(cursor - str) : 0;
+    }
 
-/** allocates aligned memory
- *  https://en.cppreference.com/w/c/memory/aligned_alloc
+    // Special values: "inf", "infinity", "nan", and "nan(n-char-sequence)", all case-insensitive
+    if ((cursor[0] | 0x20) == 'i' && (cursor[1] | 0x20) == 'n' && (cursor[2] | 0x20) == 'f') {
+        cursor += 3;
+        char const *suffix = "inity";
+        size_t matched = 0;
+        while (suffix[matched] && (cursor[matched] | 0x20) == suffix[matched]) matched++;
+        if (!suffix[matched]) cursor += matched;
+        return (size_t)(cursor - str);
+    }
+    if ((cursor[0] | 0x20) == 'n' && (cursor[1] | 0x20) == 'a' && (cursor[2] | 0x20) == 'n') {
+        cursor += 3;
+        if (*cursor == '(') {
+            char const *payload = cursor + 1;
+            while (((*payload | 0x20) >= 'a' && (*payload | 0x20) <= 'z') || (*payload >= '0' && *payload <= '9') ||
+                   *payload == '_')
+                payload++;
+            if (*payload == ')') cursor = payload + 1;
+        }
+        return (size_t)(cursor - str);
+    }
+
+    // Decimal or hexadecimal mantissa, followed by an optional exponent
+    int hexadecimal = cursor[0] == '0' && (cursor[1] | 0x20) == 'x';
+    char const *mantissa = cursor + (hexadecimal ? 2 : 0);
+    char const *digits = mantissa;
+    size_t count_digits = 0;
+#define libsee_is_digit_in_base(c) \
+    (((c) >= '0' && (c) <= '9') || (hexadecimal && ((c) | 0x20) >= 'a' && ((c) | 0x20) <= 'f'))
+    while (libsee_is_digit_in_base(*digits)) digits++, count_digits++;
+    if (*digits == '.') {
+        digits++;
+        while (libsee_is_digit_in_base(*digits)) digits++, count_digits++;
+    }
+#undef libsee_is_digit_in_base
+    // A lone "0x" is parsed as zero, followed by an unconsumed "x"
+    if (count_digits == 0) return hexadecimal ? (size_t)(cursor + 1 - str) : 0;
+    cursor = digits;
+
+    if ((*cursor | 0x20) == (hexadecimal ? 'p' : 'e')) {
+        char const *exponent = cursor + 1;
+        if (*exponent == '+' || *exponent == '-') exponent++;
+        if (*exponent >= '0' && *exponent <= '9') {
+            while (*exponent >= '0' && *exponent <= '9') exponent++;
+            cursor = exponent;
+        }
+    }
+    return (size_t)(cursor - str);
+}
+
+/** interprets an integer value in a byte string
+ *  https://en.cppreference.com/w/c/string/byte/strtol
+ *  https://en.cppreference.com/w/c/string/byte/strtoul
+ *  https://en.cppreference.com/w/c/string/byte/strtoimax
+ *
+ *  With an invalid base, glibc fails with `EINVAL` without writing the end pointer, so it's only
+ *  forwarded to the caller and counted, when it was set.
  */
-libsee_export void *aligned_alloc(size_t alignment, size_t size) {
-    libsee_return(aligned_alloc, void *, alignment, size);
+libsee_export long strtol(char const *str, char **str_end, int base) {
+    char *end = NULL;
+    long result;
+    libsee_assign(result, strtol, str, &end, base);
+    libsee_add_bytes(strtol, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export long long strtoll(char const *str, char **str_end, int base) {
+    char *end = NULL;
+    long long result;
+    libsee_assign(result, strtoll, str, &end, base);
+    libsee_add_bytes(strtoll, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export unsigned long strtoul(char const *str, char **str_end, int base) {
+    char *end = NULL;
+    unsigned long result;
+    libsee_assign(result, strtoul, str, &end, base);
+    libsee_add_bytes(strtoul, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export unsigned long long strtoull(char const *str, char **str_end, int base) {
+    char *end = NULL;
+    unsigned long long result;
+    libsee_assign(result, strtoull, str, &end, base);
+    libsee_add_bytes(strtoull, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export intmax_t strtoimax(char const *str, char **str_end, int base) {
+    char *end = NULL;
+    intmax_t result;
+    libsee_assign(result, strtoimax, str, &end, base);
+    libsee_add_bytes(strtoimax, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export uintmax_t strtoumax(char const *str, char **str_end, int base) {
+    char *end = NULL;
+    uintmax_t result;
+    libsee_assign(result, strtoumax, str, &end, base);
+    libsee_add_bytes(strtoumax, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+
+/** interprets a floating-point value in a byte string
+ *  https://en.cppreference.com/w/c/string/byte/strtof
+ */
+libsee_export float strtof(char const *str, char **str_end) {
+    char *end = NULL;
+    float result;
+    libsee_assign(result, strtof, str, &end);
+    libsee_add_bytes(strtof, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export double strtod(char const *str, char **str_end) {
+    char *end = NULL;
+    double result;
+    libsee_assign(result, strtod, str, &end);
+    libsee_add_bytes(strtod, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export long double strtold(char const *str, char **str_end) {
+    char *end = NULL;
+    long double result;
+    libsee_assign(result, strtold, str, &end);
+    libsee_add_bytes(strtold, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+
+/** relevant @b extensions, parsing numbers according to an explicitly passed locale
+ *  https://man7.org/linux/man-pages/man3/strtol.3.html
+ */
+libsee_export long strtol_l(char const *str, char **str_end, int base, locale_t locale) {
+    char *end = NULL;
+    long result;
+    libsee_assign(result, strtol_l, str, &end, base, locale);
+    libsee_add_bytes(strtol_l, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export long long strtoll_l(char const *str, char **str_end, int base, locale_t locale) {
+    char *end = NULL;
+    long long result;
+    libsee_assign(result, strtoll_l, str, &end, base, locale);
+    libsee_add_bytes(strtoll_l, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export unsigned long strtoul_l(char const *str, char **str_end, int base, locale_t locale) {
+    char *end = NULL;
+    unsigned long result;
+    libsee_assign(result, strtoul_l, str, &end, base, locale);
+    libsee_add_bytes(strtoul_l, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export unsigned long long strtoull_l(char const *str, char **str_end, int base, locale_t locale) {
+    char *end = NULL;
+    unsigned long long result;
+    libsee_assign(result, strtoull_l, str, &end, base, locale);
+    libsee_add_bytes(strtoull_l, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export float strtof_l(char const *str, char **str_end, locale_t locale) {
+    char *end = NULL;
+    float result;
+    libsee_assign(result, strtof_l, str, &end, locale);
+    libsee_add_bytes(strtof_l, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export double strtod_l(char const *str, char **str_end, locale_t locale) {
+    char *end = NULL;
+    double result;
+    libsee_assign(result, strtod_l, str, &end, locale);
+    libsee_add_bytes(strtod_l, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+libsee_export long double strtold_l(char const *str, char **str_end, locale_t locale) {
+    char *end = NULL;
+    long double result;
+    libsee_assign(result, strtold_l, str, &end, locale);
+    libsee_add_bytes(strtold_l, end ? end - str : 0);
+    if (str_end && end) *str_end = end;
+    return result;
+}
+
+/** converts a byte string to an integer value
+ *  https://en.cppreference.com/w/c/string/byte/atoi
+ */
+libsee_export int atoi(char const *str) {
+    int result;
+    libsee_assign(result, atoi, str);
+    libsee_add_bytes(atoi, libsee_numeric_prefix_length(str, 0));
+    return result;
+}
+libsee_export long atol(char const *str) {
+    long result;
+    libsee_assign(result, atol, str);
+    libsee_add_bytes(atol, libsee_numeric_prefix_length(str, 0));
+    return result;
+}
+libsee_export long long atoll(char const *str) {
+    long long result;
+    libsee_assign(result, atoll, str);
+    libsee_add_bytes(atoll, libsee_numeric_prefix_length(str, 0));
+    return result;
+}
+
+/** converts a byte string to a floating-point value
+ *  https://en.cppreference.com/w/c/string/byte/atof
+ */
+libsee_export double atof(char const *str) {
+    double result;
+    libsee_assign(result, atof, str);
+    libsee_add_bytes(atof, libsee_numeric_prefix_length(str, 1));
+    return result;
+}
+
+/** converts a floating-point value to a byte string, C23 and GLibC 2.25+
+ *  https://en.cppreference.com/w/c/string/byte/strfromf
+ */
+libsee_export int strfromf(char *str, size_t n, char const *format, float fp) {
+    int result;
+    libsee_assign(result, strfromf, str, n, format, fp);
+    if (result > 0) libsee_add_bytes(strfromf, result);
+    return result;
+}
+libsee_export int strfromd(char *str, size_t n, char const *format, double fp) {
+    int result;
+    libsee_assign(result, strfromd, str, n, format, fp);
+    if (result > 0) libsee_add_bytes(strfromd, result);
+    return result;
+}
+libsee_export int strfroml(char *str, size_t n, char const *format, long double fp) {
+    int result;
+    libsee_assign(result, strfroml, str, n, format, fp);
+    if (result > 0) libsee_add_bytes(strfroml, result);
+    return result;
 }
 
 #pragma endregion
 
-#pragma region Algorithms // Contents of `stdlib.h`
+#pragma region Localization // Contents of `locale.h` and `langinfo.h`
 
-/** sorts an array
- *  https://en.cppreference.com/w/c/algorithm/qsort
+/*
+ *  Locale lookups are cheap, but `setlocale` and `localeconv` serialize all threads on a global lock.
+ *  Third-party code sometimes calls them on every request, so all locale functions are attributed
+ *  to call sites and threads, and the peak per-second rate of the locking ones is tracked.
+ */
+static libsee_rate_stats libsee_setlocale_rate = {0};
+static libsee_rate_stats libsee_localeconv_rate = {0};
+
+/** gets and sets the current C locale
+ *  https://en.cppreference.com/w/c/locale/setlocale
+ */
+libsee_export char *setlocale(int category, char const *locale) {
+    char *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, setlocale, category, locale);
+    libsee_track_call_site(setlocale, cycles);
+    libsee_track_thread(setlocale, cycles);
+    libsee_rate_add(&libsee_setlocale_rate);
+    return result;
+}
+
+/** queries numeric and monetary formatting details of the current locale
+ *  https://en.cppreference.com/w/c/locale/localeconv
+ */
+libsee_export struct lconv *localeconv(void) {
+    struct lconv *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, localeconv);
+    libsee_track_call_site(localeconv, cycles);
+    libsee_track_thread(localeconv, cycles);
+    libsee_rate_add(&libsee_localeconv_rate);
+    return result;
+}
+
+/** relevant POSIX @b extensions for thread-local locales
+ *  https://man7.org/linux/man-pages/man3/newlocale.3.html
+ *  https://man7.org/linux/man-pages/man3/uselocale.3.html
+ *  https://man7.org/linux/man-pages/man3/duplocale.3.html
+ */
+libsee_export locale_t newlocale(int category_mask, char const *locale, locale_t base) {
+    locale_t result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, newlocale, category_mask, locale, base);
+    libsee_track_call_site(newlocale, cycles);
+    libsee_track_thread(newlocale, cycles);
+    return result;
+}
+
+libsee_export locale_t uselocale(locale_t locale) {
+    locale_t result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, uselocale, locale);
+    libsee_track_call_site(uselocale, cycles);
+    libsee_track_thread(uselocale, cycles);
+    return result;
+}
+
+libsee_export locale_t duplocale(locale_t locale) {
+    locale_t result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, duplocale, locale);
+    libsee_track_call_site(duplocale, cycles);
+    libsee_track_thread(duplocale, cycles);
+    return result;
+}
+
+libsee_export void freelocale(locale_t locale) {
+    size_t cycles;
+    libsee_noreturn_cycles(cycles, freelocale, locale);
+    libsee_track_call_site(freelocale, cycles);
+    libsee_track_thread(freelocale, cycles);
+}
+
+/** queries language and locale information
+ *  https://man7.org/linux/man-pages/man3/nl_langinfo.3.html
+ */
+libsee_export char *nl_langinfo(nl_item item) {
+    char *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, nl_langinfo, item);
+    libsee_track_call_site(nl_langinfo, cycles);
+    libsee_track_thread(nl_langinfo, cycles);
+    return result;
+}
+
+#pragma endregion
+
+#pragma region Input / Output // Contents of `stdio.h`
+
+#include <stdarg.h> // `va_start`
+
+/**
+ *  @brief  Per-file statistics, keyed by the path pattern passed to `fopen` or `freopen`.
  *
- *  Despite the name, neither C nor POSIX standards require this function to be implemented
- *  using quicksort or make any complexity or stability guarantees.
+ *  Every run of digits in the path is collapsed into a single '#', so that rotated logs, shards,
+ *  and temporary files are reported together. Overly long paths keep their tail, as the file
+ *  names tend to be more distinctive than the directories.
  */
-libsee_export void qsort(void *base, size_t count, size_t size, int (*compare)(void const *, void const *)) {
-    libsee_noreturn(qsort, base, count, size, compare);
+typedef struct libsee_path_stats {
+    size_t key; // Hash of the pattern, or zero for free slots
+    size_t calls;
+    size_t cycles;
+    size_t bytes;
+    size_t seeks;
+    size_t sequential_reads; // Reads starting where the previous one ended
+    size_t sequential_bytes;
+    size_t strided_reads; // Reads skipping the same distance as the previous one
+    size_t strided_bytes;
+    size_t random_reads; // All other reads
+    size_t random_bytes;
+    char pattern[LIBSEE_MAX_PATH_LENGTH];
+} libsee_path_stats;
+
+static libsee_path_stats libsee_paths[LIBSEE_MAX_PATHS] = {0};
+
+static inline int libsee_is_digit(char c) { return c >= '0' && c <= '9'; }
+
+size_t libsee_path_pattern(char const *path, char *pattern, size_t capacity) {
+    // The first pass measures the collapsed pattern, the second one emits the tail that fits
+    size_t collapsed_length = 0;
+    for (char const *it = path; *it; ++it)
+        collapsed_length += !(libsee_is_digit(*it) && it != path && libsee_is_digit(it[-1]));
+    size_t length = 0, skipped = 0, position = 0;
+    if (collapsed_length >= capacity) {
+        skipped = collapsed_length - (capacity - 4);
+        pattern[length++] = '.', pattern[length++] = '.', pattern[length++] = '.';
+    }
+    for (char const *it = path; *it; ++it) {
+        int digit = libsee_is_digit(*it);
+        if (digit && it != path && libsee_is_digit(it[-1])) continue;
+        if (position++ < skipped) continue;
+        pattern[length++] = digit ? '#' : *it;
+    }
+    pattern[length] = 0;
+    return length;
 }
-libsee_export void qsort_s(void *base, rsize_t count, rsize_t size, int (*compare)(void const *, void const *, void *),
-    void *context) {
-    libsee_noreturn(qsort_s, base, count, size, compare, context);
+
+/**
+ *  @brief  Identity of the slots keyed by a string, like a path pattern, an expression, or a name.
+ */
+typedef struct libsee_text_identity {
+    char const *text;
+    size_t length;
+} libsee_text_identity;
+
+int libsee_path_matches(void const *slot, void const *identity) {
+    libsee_text_identity const *text = (libsee_text_identity const *)identity;
+    return libsee_stored_equal(((libsee_path_stats const *)slot)->pattern, text->text, text->length);
 }
 
-/** searches an array for a given value
- *  https://en.cppreference.com/w/c/algorithm/bsearch
+void libsee_path_fill(void *slot, void const *identity) {
+    libsee_text_identity const *text = (libsee_text_identity const *)identity;
+    libsee_store_string(((libsee_path_stats *)slot)->pattern, text->text, text->length);
+}
+
+libsee_path_stats *libsee_path_slot(char const *path) {
+    char pattern[LIBSEE_MAX_PATH_LENGTH];
+    size_t length = libsee_path_pattern(path, pattern, LIBSEE_MAX_PATH_LENGTH);
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    for (size_t i = 0; i != length; ++i) hash = (hash ^ (unsigned char)pattern[i]) * 0x100000001B3ull;
+    libsee_text_identity identity = {pattern, length};
+    return (libsee_path_stats *)libsee_shared_slot(libsee_paths, sizeof(libsee_path_stats), LIBSEE_MAX_PATHS,
+        (size_t)hash, &identity, libsee_path_matches, libsee_path_fill);
+}
+
+/**
+ *  @brief  Per-stream statistics, keyed by the address of the `FILE` object.
  *
- *  Despite the name, neither C nor POSIX standards require this function to be implemented
- *  using binary search or make any complexity guarantees.
+ *  The costs of the character-level I/O are split between the locking functions and their `_unlocked`
+ *  variants, to estimate the savings of `flockfile` and `_unlocked` calls. The bulk transfers are split
+ *  between calls served from the user-space buffer and calls that had to refill or flush it. All the costs
+ *  are also attributed to the file, that the stream was opened for, or to the name of the standard stream.
  */
-libsee_export void *bsearch(void const *key, void const *base, size_t count, size_t size,
-    int (*compare)(void const *, void const *)) {
-    libsee_return(bsearch, void *, key, base, count, size, compare);
+typedef struct libsee_stream_stats {
+    size_t key;     // Published, busy, or zero for free slots, like the shared tables, and one after `fclose`
+    FILE *stream;   // Only compared, never dereferenced, as the stream may be closed before the report
+    int descriptor; // Captured when the slot is claimed, as the stream may be closed before the report
+    size_t locked_calls;
+    size_t locked_cycles;
+    size_t locked_bytes;
+    size_t unlocked_calls;
+    size_t unlocked_cycles;
+    size_t unlocked_bytes;
+    size_t buffered_calls; // Calls served entirely from the user-space buffer
+    size_t kernel_calls;   // Calls that refilled or flushed the buffer, issuing `read` or `write` system calls
+    size_t kernel_bytes;   // Bytes moved between the buffer and the kernel by those calls
+    int buffer_mode;       // Last observed `_IOFBF`, `_IOLBF`, or `_IONBF`
+    int buffer_configured; // Whether `setvbuf` or `setbuf` was called on the stream
+    size_t buffer_size;    // Last observed buffer capacity in bytes
+    libsee_path_stats *path;
+    long long position;          // Logical offset, tracked through the transfers and seeks, or -1 if unknown
+    long long previous_read_end; // Offset, where the previous read ended, or -1 before the first read
+    long long previous_stride;   // Distance between the previous two reads
+} libsee_stream_stats;
+
+static libsee_stream_stats libsee_streams[LIBSEE_MAX_STREAMS] = {0};
+
+void libsee_stream_fill(libsee_stream_stats *slot, FILE *stream) {
+    libsee_stream_stats claimed = {0};
+    claimed.key = slot->key;
+    claimed.stream = stream;
+    claimed.descriptor = fileno(stream);
+    claimed.position = claimed.previous_read_end = -1;
+    claimed.path = libsee_path_slot(stream == stdin    ? "<stdin>"
+                                    : stream == stdout ? "<stdout>"
+                                    : stream == stderr ? "<stderr>"
+                                                       : "<unnamed stream>");
+    *slot = claimed;
 }
-libsee_export void *bsearch_s(void const *key, void const *base, rsize_t count, rsize_t size,
-    int (*compare)(void const *, void const *, void *), void *context) {
-    libsee_return(bsearch_s, void *, key, base, count, size, compare, context);
+
+/**
+ *  @brief  Finds the slot of a stream, or claims one for it, following the busy and published keys of
+ *          `libsee_shared_slot`. The slots of the closed streams keep their statistics for the report,
+ *          and are only reused once no free slot is left within the probes.
+ *  @param  claim   Whether to claim a slot for an unseen stream, or only look the stream up.
+ */
+libsee_stream_stats *libsee_stream_find(FILE *stream, int claim) {
+    if (!stream) return NULL;
+    unsigned long long hash = (unsigned long long)(size_t)stream * 0x9E3779B97F4A7C15ull;
+    size_t start = (size_t)(hash ^ (hash >> 32));
+    // Released slots are marked with one, that is odd like the published keys, but never equal to them
+    size_t published = start | 3, busy = published & ~(size_t)1;
+    size_t probes = LIBSEE_MAX_STREAMS < LIBSEE_MAX_PROBES ? LIBSEE_MAX_STREAMS : LIBSEE_MAX_PROBES;
+    libsee_stream_stats *released = NULL;
+    for (size_t probe = 0; probe < probes; probe++) {
+        libsee_stream_stats *slot = &libsee_streams[(start + probe) % LIBSEE_MAX_STREAMS];
+        size_t existing = __atomic_load_n(&slot->key, __ATOMIC_ACQUIRE);
+        if (existing == 0 && claim &&
+            __atomic_compare_exchange_n(&slot->key, &existing, busy, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            libsee_stream_fill(slot, stream);
+            __atomic_store_n(&slot->key, published, __ATOMIC_RELEASE);
+            return slot;
+        }
+        while (existing == busy) existing = __atomic_load_n(&slot->key, __ATOMIC_ACQUIRE);
+        if (existing == published && slot->stream == stream) return slot;
+        if (existing == 1 && !released) released = slot;
+        if (existing == 0) break;
+    }
+    if (!claim) return NULL;
+    size_t existing = 1;
+    if (released &&
+        __atomic_compare_exchange_n(&released->key, &existing, busy, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        libsee_stream_fill(released, stream);
+        __atomic_store_n(&released->key, published, __ATOMIC_RELEASE);
+        return released;
+    }
+    __atomic_fetch_add(&libsee_dropped_updates, 1, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+libsee_stream_stats *libsee_stream_slot(FILE *stream) { return libsee_stream_find(stream, 1); }
+
+/**
+ *  @brief  Called after a successful `fopen` or `freopen` to attribute the following calls to a new file.
+ */
+void libsee_stream_open(FILE *stream, char const *path, char const *mode) {
+    libsee_stream_stats *slot = libsee_stream_slot(stream);
+    if (!slot) return;
+    slot->descriptor = fileno(stream);
+    slot->position = mode[0] == 'a' ? -1 : 0; // Appending streams start at an unknown offset
+    slot->previous_read_end = -1;
+    if (path) slot->path = libsee_path_slot(path);
+}
+
+/**
+ *  @brief  Updates the logical offset of a stream after a successful seek. Positions relative to the end
+ *          of the file or opaque `fpos_t` objects are resolved with `ftello`, which isn't intercepted.
+ */
+void libsee_stream_seeked(libsee_stream_stats *slot, FILE *stream, long long offset, int whence) {
+    if (!slot) return;
+    if (whence == SEEK_SET) slot->position = offset;
+    else if (whence == SEEK_CUR && slot->position >= 0) slot->position += offset;
+    else slot->position = ftello(stream);
+}
+
+/**
+ *  @brief  Advances the logical offset of a stream after a transfer, classifying the reads by the distance
+ *          from the end of the previous read: zero for sequential scans, a repeating one for strided access.
+ */
+void libsee_stream_advance(libsee_stream_stats *slot, int writing, size_t bytes) {
+    if (!slot || slot->position < 0) return;
+    long long offset = slot->position;
+    slot->position += (long long)bytes;
+    if (writing || !bytes || !slot->path) return;
+
+    libsee_path_stats *path = slot->path;
+    long long stride = slot->previous_read_end < 0 ? 0 : offset - slot->previous_read_end;
+    if (stride == 0) {
+        __atomic_fetch_add(&path->sequential_reads, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&path->sequential_bytes, bytes, __ATOMIC_RELAXED);
+    }
+    else if (stride == slot->previous_stride) {
+        __atomic_fetch_add(&path->strided_reads, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&path->strided_bytes, bytes, __ATOMIC_RELAXED);
+    }
+    else {
+        __atomic_fetch_add(&path->random_reads, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&path->random_bytes, bytes, __ATOMIC_RELAXED);
+    }
+    slot->previous_stride = stride;
+    slot->previous_read_end = slot->position;
+}
+
+void libsee_path_add(libsee_stream_stats *slot, size_t cycles, size_t bytes, int seeking) {
+    if (!slot || !slot->path) return;
+    libsee_path_stats *path = slot->path;
+    __atomic_fetch_add(&path->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&path->cycles, cycles, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&path->bytes, bytes, __ATOMIC_RELAXED);
+    if (seeking) __atomic_fetch_add(&path->seeks, 1, __ATOMIC_RELAXED);
+}
+
+void libsee_stream_add(libsee_stream_stats *slot, int unlocked, size_t cycles, size_t bytes) {
+    if (!slot) return;
+    __atomic_fetch_add(unlocked ? &slot->unlocked_calls : &slot->locked_calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(unlocked ? &slot->unlocked_cycles : &slot->locked_cycles, cycles, __ATOMIC_RELAXED);
+    __atomic_fetch_add(unlocked ? &slot->unlocked_bytes : &slot->locked_bytes, bytes, __ATOMIC_RELAXED);
+}
+
+/**
+ *  @brief  Positions of the stream buffer pointers before a call.
+ *
+ *  The `read` and `write` system calls issued inside the C library don't pass through the dynamic linker,
+ *  so they can't be intercepted directly. Instead, we compare the buffer pointers before and after every
+ *  call: a call that moved more bytes between the buffer and the kernel than the caller asked for, or
+ *  fewer than it asked for, must have refilled or flushed the buffer. Only GLibC exposes those pointers.
+ */
+typedef struct libsee_buffer_snapshot {
+    char *read_ptr;
+    char *read_end;
+    char *write_base;
+    char *write_ptr;
+} libsee_buffer_snapshot;
+
+/*  Internal GLibC `_flags` bits, not exported by the public headers.  */
+#define LIBSEE_GLIBC_UNBUFFERED 0x0002
+#define LIBSEE_GLIBC_LINE_BUFFERED 0x0200
+
+libsee_buffer_snapshot libsee_snapshot_buffer(FILE *stream) {
+    libsee_buffer_snapshot snapshot = {0};
+#if defined(__GLIBC__)
+    if (stream) {
+        snapshot.read_ptr = stream->_IO_read_ptr;
+        snapshot.read_end = stream->_IO_read_end;
+        snapshot.write_base = stream->_IO_write_base;
+        snapshot.write_ptr = stream->_IO_write_ptr;
+    }
+#endif
+    return snapshot;
+}
+
+void libsee_stream_add_buffering(
+    libsee_stream_stats *slot, FILE *stream, libsee_buffer_snapshot before, int writing, size_t bytes) {
+#if defined(__GLIBC__)
+    if (!slot) return;
+    ptrdiff_t kernel_bytes;
+    int pointers_moved;
+    if (writing) {
+        ptrdiff_t pending_before = before.write_ptr - before.write_base;
+        ptrdiff_t pending_after = stream->_IO_write_ptr - stream->_IO_write_base;
+        kernel_bytes = pending_before + (ptrdiff_t)bytes - pending_after;
+        pointers_moved = before.write_base && before.write_base != stream->_IO_write_base;
+    }
+    else {
+        ptrdiff_t available_before = before.read_end - before.read_ptr;
+        ptrdiff_t available_after = stream->_IO_read_end - stream->_IO_read_ptr;
+        kernel_bytes = (ptrdiff_t)bytes + available_after - available_before;
+        pointers_moved = before.read_end != stream->_IO_read_end;
+    }
+    if (kernel_bytes > 0 || pointers_moved) {
+        __atomic_fetch_add(&slot->kernel_calls, 1, __ATOMIC_RELAXED);
+        if (kernel_bytes > 0) __atomic_fetch_add(&slot->kernel_bytes, (size_t)kernel_bytes, __ATOMIC_RELAXED);
+    }
+    else
+        __atomic_fetch_add(&slot->buffered_calls, 1, __ATOMIC_RELAXED);
+    int flags = stream->_flags;
+    slot->buffer_mode = (flags & LIBSEE_GLIBC_UNBUFFERED)     ? _IONBF
+                        : (flags & LIBSEE_GLIBC_LINE_BUFFERED) ? _IOLBF
+                                                               : _IOFBF;
+    slot->buffer_size = (size_t)(stream->_IO_buf_end - stream->_IO_buf_base);
+#else
+    (void)slot, (void)stream, (void)before, (void)writing, (void)bytes;
+#endif
+}
+
+/*
+ *  The wrappers of bulk and formatted I/O snapshot the buffer before the call and account for
+ *  the transferred bytes afterwards, in addition to the usual per-function counters.
+ */
+#define libsee_buffered_io(function_name, return_type, stream, direction, bytes_count, ...) \
+    do {                                                                                    \
+        FILE *_stream = (stream);                                                           \
+        libsee_stream_stats *_slot = libsee_stream_slot(_stream);                           \
+        libsee_buffer_snapshot _before = libsee_snapshot_buffer(_stream);                   \
+        return_type _result;                                                                \
+        size_t _cycles;                                                                     \
+        libsee_assign_cycles(_result, _cycles, function_name, __VA_ARGS__);                 \
+        size_t _bytes = (bytes_count);                                                      \
+        libsee_add_bytes(function_name, _bytes);                                            \
+        libsee_stream_add_buffering(_slot, _stream, _before, (direction) == 'w', _bytes);   \
+        libsee_stream_advance(_slot, (direction) == 'w', _bytes);                           \
+        libsee_path_add(_slot, _cycles, _bytes, 0);                                         \
+        return _result;                                                                     \
+    } while (0)
+
+/*
+ *  The wrappers of housekeeping calls only attribute their costs to the file.
+ */
+#define libsee_positioning_io(function_name, return_type, stream, ...)      \
+    do {                                                                    \
+        libsee_stream_stats *_slot = libsee_stream_slot(stream);            \
+        return_type _result;                                                \
+        size_t _cycles;                                                     \
+        libsee_assign_cycles(_result, _cycles, function_name, __VA_ARGS__); \
+        libsee_path_add(_slot, _cycles, 0, 0);                              \
+        return _result;                                                     \
+    } while (0)
+
+/** opens a file
+ *  https://en.cppreference.com/w/c/io/fopen
+ */
+libsee_export FILE *fopen(const char *filename, char const *mode) {
+    FILE *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, fopen, filename, mode);
+    if (result) libsee_stream_open(result, filename, mode), libsee_path_add(libsee_stream_slot(result), cycles, 0, 0);
+    return result;
+}
+
+/** reopens a file stream with a different file or mode
+ *  https://en.cppreference.com/w/c/io/freopen
+ */
+libsee_export FILE *freopen(char const *filename, char const *mode, FILE *stream) {
+    FILE *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, freopen, filename, mode, stream);
+    if (result) libsee_stream_open(result, filename, mode), libsee_path_add(libsee_stream_slot(result), cycles, 0, 0);
+    return result;
+}
+
+/** closes a file
+ *  https://en.cppreference.com/w/c/io/fclose
+ */
+libsee_export int fclose(FILE *stream) {
+    libsee_stream_stats *slot = libsee_stream_find(stream, 0);
+    // Released before the call, as another thread may get the same `FILE` address from `fopen` right after it
+    if (slot) __atomic_store_n(&slot->key, 1, __ATOMIC_RELEASE);
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, fclose, stream);
+    libsee_path_add(slot, cycles, 0, 0);
+    return result;
+}
+
+/** synchronizes an output stream with the actual file
+ *  https://en.cppreference.com/w/c/io/fflush
+ */
+libsee_export int fflush(FILE *stream) { libsee_positioning_io(fflush, int, stream, stream); }
+
+/** sets the buffer for a file stream
+ *  https://en.cppreference.com/w/c/io/setbuf
+ */
+libsee_export void setbuf(FILE *stream, char *buf) {
+    libsee_stream_stats *slot = libsee_stream_slot(stream);
+    if (slot) slot->buffer_configured = 1;
+    libsee_noreturn(setbuf, stream, buf);
+}
+
+/** sets the buffer and its size for a file stream
+ *  https://en.cppreference.com/w/c/io/setvbuf
+ *
+ *  The setvbuf function may be used to specify the buffering for stream.
+ */
+libsee_export int setvbuf(FILE *stream, char *buf, int mode, size_t size) {
+    libsee_stream_stats *slot = libsee_stream_slot(stream);
+    if (slot) slot->buffer_configured = 1;
+    libsee_return(setvbuf, int, stream, buf, mode, size);
+}
+
+/** reads from a file
+ *  https://en.cppreference.com/w/c/io/fread
+ */
+libsee_export size_t fread(void *ptr, size_t size, size_t nmemb, FILE *stream) {
+    libsee_buffered_io(fread, size_t, stream, 'r', _result * size, ptr, size, nmemb, stream);
+}
+
+/** writes to a file
+ *  https://en.cppreference.com/w/c/io/fwrite
+ */
+libsee_export size_t fwrite(void const *ptr, size_t size, size_t nmemb, FILE *stream) {
+    libsee_buffered_io(fwrite, size_t, stream, 'w', _result * size, ptr, size, nmemb, stream);
+}
+
+/** moves the file position indicator to a specific location in a file
+ *  https://en.cppreference.com/w/c/io/fseek
+ */
+libsee_export int fseek(FILE *stream, long offset, int whence) {
+    libsee_stream_stats *slot = libsee_stream_slot(stream);
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, fseek, stream, offset, whence);
+    libsee_path_add(slot, cycles, 0, 1);
+    if (result == 0) libsee_stream_seeked(slot, stream, offset, whence);
+    return result;
+}
+
+/** returns the current file position indicator
+ *  https://en.cppreference.com/w/c/io/ftell
+ */
+libsee_export long ftell(FILE *stream) {
+    libsee_stream_stats *slot = libsee_stream_slot(stream);
+    long result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, ftell, stream);
+    libsee_path_add(slot, cycles, 0, 0);
+    if (result >= 0) libsee_stream_seeked(slot, stream, result, SEEK_SET);
+    return result;
+}
+
+/** sets the file position of the given stream to the given position
+ *  https://en.cppreference.com/w/c/io/fsetpos
+ */
+libsee_export int fsetpos(FILE *stream, fpos_t const *pos) {
+    libsee_stream_stats *slot = libsee_stream_slot(stream);
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, fsetpos, stream, pos);
+    libsee_path_add(slot, cycles, 0, 1);
+    if (result == 0) libsee_stream_seeked(slot, stream, 0, SEEK_END); // Resolves the opaque position via `ftello`
+    return result;
+}
+
+/** gets the file position indicator
+ *  https://en.cppreference.com/w/c/io/fgetpos
+ */
+libsee_export int fgetpos(FILE *stream, fpos_t *pos) { libsee_positioning_io(fgetpos, int, stream, stream, pos); }
+
+/** moves the file position indicator to the beginning of a file
+ *  https://en.cppreference.com/w/c/io/rewind
+ */
+libsee_export void rewind(FILE *stream) {
+    libsee_stream_stats *slot = libsee_stream_slot(stream);
+    size_t cycles;
+    libsee_noreturn_cycles(cycles, rewind, stream);
+    libsee_path_add(slot, cycles, 0, 1);
+    libsee_stream_seeked(slot, stream, 0, SEEK_SET);
+}
+
+/** clears errors
+ *  https://en.cppreference.com/w/c/io/clearerr
+ */
+libsee_export void clearerr(FILE *stream) { libsee_noreturn(clearerr, stream); }
+
+/** checks for the end-of-file
+ *  https://en.cppreference.com/w/c/io/feof
+ */
+libsee_export int feof(FILE *stream) { libsee_return(feof, int, stream); }
+
+/** checks for a file error
+ *  https://en.cppreference.com/w/c/io/ferror
+ */
+libsee_export int ferror(FILE *stream) { libsee_return(ferror, int, stream); }
+
+/*
+ *  Every character-level wrapper below follows the same pattern, so it's generated by a macro.
+ *  With optimizations enabled, GLibC headers inline `getchar`, `putchar`, and the `_unlocked` variants,
+ *  so the latter may only be observed in unoptimized builds or when called through pointers.
+ */
+#define libsee_character_io(function_name, return_type, stream, unlocked, direction, bytes_count, ...) \
+    do {                                                                                               \
+        FILE *_stream = (stream);                                                                      \
+        libsee_stream_stats *_slot = libsee_stream_slot(_stream);                                      \
+        libsee_buffer_snapshot _before = libsee_snapshot_buffer(_stream);                              \
+        return_type _result;                                                                           \
+        size_t _cycles;                                                                                \
+        libsee_assign_cycles(_result, _cycles, function_name, __VA_ARGS__);                            \
+        size_t _bytes = (bytes_count);                                                                 \
+        libsee_add_bytes(function_name, _bytes);                                                       \
+        libsee_stream_add(_slot, unlocked, _cycles, _bytes);                                           \
+        if (direction) {                                                                               \
+            libsee_stream_add_buffering(_slot, _stream, _before, (direction) == 'w', _bytes);          \
+            libsee_stream_advance(_slot, (direction) == 'w', _bytes);                                  \
+        }                                                                                              \
+        libsee_path_add(_slot, _cycles, _bytes, 0);                                                    \
+        return _result;                                                                                \
+    } while (0)
+
+/** gets a character from a file stream
+ *  https://en.cppreference.com/w/c/io/fgetc
+ *  https://en.cppreference.com/w/c/io/getchar
+ */
+libsee_export int fgetc(FILE *stream) { libsee_character_io(fgetc, int, stream, 0, 'r', _result != EOF, stream); }
+libsee_export int getc(FILE *stream) { libsee_character_io(getc, int, stream, 0, 'r', _result != EOF, stream); }
+libsee_export int getchar(void) { libsee_character_io(getchar, int, stdin, 0, 'r', _result != EOF); }
+
+/** gets a character string from a file stream
+ *  https://en.cppreference.com/w/c/io/fgets
+ */
+libsee_export char *fgets(char *str, int count, FILE *stream) {
+    libsee_character_io(fgets, char *, stream, 0, 'r', _result ? libsee_apis.strlen(str) : 0, str, count, stream);
+}
+
+/** puts a character back into a file stream
+ *  https://en.cppreference.com/w/c/io/ungetc
+ */
+libsee_export int ungetc(int ch, FILE *stream) { libsee_character_io(ungetc, int, stream, 0, 0, 0, ch, stream); }
+
+/** relevant POSIX @b extensions for reading delimited records of arbitrary length
+ *  https://man7.org/linux/man-pages/man3/getline.3.html
+ */
+libsee_export ssize_t getline(char **line, size_t *capacity, FILE *stream) {
+    libsee_character_io(getline, ssize_t, stream, 0, 'r', _result > 0 ? (size_t)_result : 0, line, capacity, stream);
+}
+libsee_export ssize_t getdelim(char **line, size_t *capacity, int delimiter, FILE *stream) {
+    libsee_character_io(
+        getdelim, ssize_t, stream, 0, 'r', _result > 0 ? (size_t)_result : 0, line, capacity, delimiter, stream);
+}
+
+/** writes a character to a file stream
+ *  https://en.cppreference.com/w/c/io/fputc
+ *  https://en.cppreference.com/w/c/io/putchar
+ */
+libsee_export int fputc(int ch, FILE *stream) {
+    libsee_character_io(fputc, int, stream, 0, 'w', _result != EOF, ch, stream);
+}
+libsee_export int putc(int ch, FILE *stream) {
+    libsee_character_io(putc, int, stream, 0, 'w', _result != EOF, ch, stream);
+}
+libsee_export int putchar(int ch) { libsee_character_io(putchar, int, stdout, 0, 'w', _result != EOF, ch); }
+
+/** writes a character string to a file stream
+ *  https://en.cppreference.com/w/c/io/fputs
+ *  https://en.cppreference.com/w/c/io/puts
+ */
+libsee_export int fputs(char const *str, FILE *stream) {
+    libsee_character_io(fputs, int, stream, 0, 'w', _result >= 0 ? libsee_apis.strlen(str) : 0, str, stream);
+}
+libsee_export int puts(char const *str) {
+    libsee_character_io(puts, int, stdout, 0, 'w', _result >= 0 ? libsee_apis.strlen(str) + 1 : 0, str);
+}
+
+/** relevant POSIX and GNU @b extensions, skipping the stream lock
+ *  https://man7.org/linux/man-pages/man3/unlocked_stdio.3.html
+ */
+libsee_export int fgetc_unlocked(FILE *stream) {
+    libsee_character_io(fgetc_unlocked, int, stream, 1, 'r', _result != EOF, stream);
+}
+libsee_export int getc_unlocked(FILE *stream) {
+    libsee_character_io(getc_unlocked, int, stream, 1, 'r', _result != EOF, stream);
+}
+libsee_export int getchar_unlocked(void) { libsee_character_io(getchar_unlocked, int, stdin, 1, 'r', _result != EOF); }
+libsee_export char *fgets_unlocked(char *str, int count, FILE *stream) {
+    libsee_character_io(
+        fgets_unlocked, char *, stream, 1, 'r', _result ? libsee_apis.strlen(str) : 0, str, count, stream);
+}
+libsee_export int fputc_unlocked(int ch, FILE *stream) {
+    libsee_character_io(fputc_unlocked, int, stream, 1, 'w', _result != EOF, ch, stream);
+}
+libsee_export int putc_unlocked(int ch, FILE *stream) {
+    libsee_character_io(putc_unlocked, int, stream, 1, 'w', _result != EOF, ch, stream);
+}
+libsee_export int putchar_unlocked(int ch) {
+    libsee_character_io(putchar_unlocked, int, stdout, 1, 'w', _result != EOF, ch);
+}
+libsee_export int fputs_unlocked(char const *str, FILE *stream) {
+    libsee_character_io(fputs_unlocked, int, stream, 1, 'w', _result >= 0 ? libsee_apis.strlen(str) : 0, str, stream);
+}
+
+/** displays a character string corresponding of the current error to stderr
+ *  https://en.cppreference.com/w/c/io/perror
+ */
+libsee_export void perror(char const *s) { libsee_noreturn(perror, s); }
+
+/** reads formatted input from stdin
+ *  https://en.cppreference.com/w/c/io/fscanf
+ */
+libsee_export int scanf(char const *format, ...) {
+    va_list args;
+    int result;
+    va_start(args, format);
+    libsee_assign(result, vscanf, format, args);
+    va_end(args);
+    return result;
+}
+
+libsee_export int fscanf(FILE *stream, char const *format, ...) {
+    va_list args;
+    int result;
+    va_start(args, format);
+    libsee_assign(result, vfscanf, stream, format, args);
+    va_end(args);
+    return result;
+}
+
+libsee_export int sscanf(char const *str, char const *format, ...) {
+    va_list args;
+    int result;
+    va_start(args, format);
+    libsee_assign(result, vsscanf, str, format, args);
+    va_end(args);
+    return result;
+}
+
+/** reads formatted input from stdin
+ *  https://en.cppreference.com/w/c/io/vscanf
+ */
+libsee_export int vscanf(char const *format, va_list vlist) { libsee_return(vscanf, int, format, vlist); }
+
+libsee_export int vfscanf(FILE *stream, char const *format, va_list vlist) {
+    libsee_return(vfscanf, int, stream, format, vlist);
+}
+
+libsee_export int vsscanf(char const *str, char const *format, va_list vlist) {
+    libsee_return(vsscanf, int, str, format, vlist);
+}
+
+/** prints formatted output to stdout
+ *  https://en.cppreference.com/w/c/io/fprintf
+ */
+libsee_export int printf(char const *format, ...) {
+    int result;
+    va_list args;
+    va_start(args, format);
+    result = vprintf(format, args);
+    va_end(args);
+    return result;
+}
+
+libsee_export int fprintf(FILE *stream, char const *format, ...) {
+    int result;
+    va_list args;
+    va_start(args, format);
+    result = vfprintf(stream, format, args);
+    va_end(args);
+    return result;
+}
+
+#undef sprintf  // For MacOS
+#undef vsprintf // For MacOS
+libsee_export int sprintf(char *str, char const *format, ...) {
+    int result;
+    va_list args;
+    va_start(args, format);
+    libsee_assign(result, vsprintf, str, format, args);
+    va_end(args);
+    return result;
+}
+
+#undef snprintf  // For MacOS
+#undef vsnprintf // For MacOS
+libsee_export int snprintf(char *str, size_t size, char const *format, ...) {
+    int result;
+    va_list args;
+    va_start(args, format);
+    libsee_assign(result, vsnprintf, str, size, format, args);
+    va_end(args);
+    return result;
+}
+
+/** prints formatted output to stdout
+ *  https://en.cppreference.com/w/c/io/fprintf
+ */
+libsee_export int vprintf(char const *format, va_list vlist) {
+    libsee_buffered_io(vprintf, int, stdout, 'w', _result > 0 ? (size_t)_result : 0, format, vlist);
+}
+
+libsee_export int vfprintf(FILE *stream, char const *format, va_list vlist) {
+    libsee_buffered_io(vfprintf, int, stream, 'w', _result > 0 ? (size_t)_result : 0, stream, format, vlist);
+}
+
+libsee_export int vsprintf(char *str, char const *format, va_list vlist) {
+    libsee_return(vsprintf, int, str, format, vlist);
+}
+
+libsee_export int vsnprintf(char *str, size_t size, char const *format, va_list vlist) {
+    libsee_return(vsnprintf, int, str, size, format, vlist);
+}
+
+/*
+ *  Wide streams convert every character to the external multibyte encoding of the locale,
+ *  so beyond calls and cycles, the number of transferred wide characters is recorded separately,
+ *  while the bytes are counted in that encoding, as they would be by the narrow functions.
+ */
+#include <limits.h> // `MB_LEN_MAX`
+
+typedef struct libsee_wide_stdio_stats {
+    size_t fgetwc;
+    size_t getwc;
+    size_t fgetws;
+    size_t fputwc;
+    size_t putwc;
+    size_t fputws;
+    size_t vwprintf;
+    size_t vfwprintf;
+    size_t vswprintf;
+} libsee_wide_stdio_stats;
+
+static libsee_wide_stdio_stats libsee_wide_characters = {0};
+
+/**
+ *  @brief  Counts the bytes the wide characters take in the multibyte encoding of the current locale,
+ *          stopping at the terminating null character, and skipping the characters it can't represent.
+ */
+size_t libsee_multibyte_length(wchar_t const *characters, size_t count) {
+    char buffer[MB_LEN_MAX];
+    mbstate_t state;
+    libsee_apis.memset(&state, 0, sizeof(state));
+    size_t length = 0;
+    for (size_t i = 0; i != count && characters[i]; ++i) {
+        size_t character_length = libsee_apis.wcrtomb(buffer, characters[i], &state);
+        if (character_length != (size_t)-1) length += character_length;
+    }
+    return length;
+}
+
+#define libsee_wide_stdio_count(function_name, count) \
+    __atomic_fetch_add(&libsee_wide_characters.function_name, (count), __ATOMIC_RELAXED)
+
+#define libsee_wide_stdio_add(function_name, characters, count)                       \
+    do {                                                                              \
+        size_t _count = (count);                                                      \
+        libsee_wide_stdio_count(function_name, _count);                               \
+        libsee_add_bytes(function_name, libsee_multibyte_length(characters, _count)); \
+    } while (0)
+
+/** gets a wide character from a file stream
+ *  https://en.cppreference.com/w/c/io/fgetwc
+ */
+libsee_export wint_t fgetwc(FILE *stream) {
+    wint_t result;
+    libsee_assign(result, fgetwc, stream);
+    wchar_t character = (wchar_t)result;
+    if (result != WEOF) libsee_wide_stdio_add(fgetwc, &character, 1);
+    return result;
+}
+libsee_export wint_t getwc(FILE *stream) {
+    wint_t result;
+    libsee_assign(result, getwc, stream);
+    wchar_t character = (wchar_t)result;
+    if (result != WEOF) libsee_wide_stdio_add(getwc, &character, 1);
+    return result;
+}
+
+/** gets a wide string from a file stream
+ *  https://en.cppreference.com/w/c/io/fgetws
+ */
+libsee_export wchar_t *fgetws(wchar_t *str, int count, FILE *stream) {
+    wchar_t *result;
+    libsee_assign(result, fgetws, str, count, stream);
+    if (result) libsee_wide_stdio_add(fgetws, str, libsee_apis.wcslen(str));
+    return result;
+}
+
+/** writes a wide character to a file stream
+ *  https://en.cppreference.com/w/c/io/fputwc
+ */
+libsee_export wint_t fputwc(wchar_t ch, FILE *stream) {
+    wint_t result;
+    libsee_assign(result, fputwc, ch, stream);
+    if (result != WEOF) libsee_wide_stdio_add(fputwc, &ch, 1);
+    return result;
+}
+libsee_export wint_t putwc(wchar_t ch, FILE *stream) {
+    wint_t result;
+    libsee_assign(result, putwc, ch, stream);
+    if (result != WEOF) libsee_wide_stdio_add(putwc, &ch, 1);
+    return result;
+}
+
+/** writes a wide string to a file stream
+ *  https://en.cppreference.com/w/c/io/fputws
+ */
+libsee_export int fputws(wchar_t const *str, FILE *stream) {
+    int result;
+    libsee_assign(result, fputws, str, stream);
+    if (result >= 0) libsee_wide_stdio_add(fputws, str, libsee_apis.wcslen(str));
+    return result;
+}
+
+/** switches a file stream between wide character I/O and narrow character I/O
+ *  https://en.cppreference.com/w/c/io/fwide
+ */
+libsee_export int fwide(FILE *stream, int mode) { libsee_return(fwide, int, stream, mode); }
+
+/** reads formatted wide character input from stdin, a file stream or a buffer
+ *  https://en.cppreference.com/w/c/io/fwscanf
+ *
+ *  The variadic functions forward to the `v`-prefixed ones, where their calls are counted.
+ */
+libsee_export int fwscanf(FILE *stream, wchar_t const *format, ...) {
+    va_list args;
+    int result;
+    va_start(args, format);
+    libsee_assign(result, vfwscanf, stream, format, args);
+    va_end(args);
+    return result;
+}
+
+libsee_export int swscanf(wchar_t const *buffer, wchar_t const *format, ...) {
+    va_list args;
+    int result;
+    va_start(args, format);
+    libsee_assign(result, vswscanf, buffer, format, args);
+    va_end(args);
+    return result;
+}
+
+/** reads formatted wide character input from a file stream or a buffer using variable argument list
+ *  https://en.cppreference.com/w/c/io/vfwscanf
+ */
+libsee_export int vfwscanf(FILE *stream, wchar_t const *format, va_list vlist) {
+    libsee_return(vfwscanf, int, stream, format, vlist);
+}
+
+libsee_export int vswscanf(wchar_t const *buffer, wchar_t const *format, va_list vlist) {
+    libsee_return(vswscanf, int, buffer, format, vlist);
+}
+
+/** prints formatted wide character output to stdout, a file stream or a buffer
+ *  https://en.cppreference.com/w/c/io/fwprintf
+ *
+ *  The formatted output only stays accessible when printed into a buffer, so the bytes are only counted
+ *  for `swprintf`, while the characters are counted for all of them.
+ */
+libsee_export int wprintf(wchar_t const *format, ...) {
+    int result;
+    va_list args;
+    va_start(args, format);
+    result = vwprintf(format, args);
+    va_end(args);
+    return result;
+}
+
+libsee_export int fwprintf(FILE *stream, wchar_t const *format, ...) {
+    int result;
+    va_list args;
+    va_start(args, format);
+    result = vfwprintf(stream, format, args);
+    va_end(args);
+    return result;
+}
+
+libsee_export int swprintf(wchar_t *buffer, size_t size, wchar_t const *format, ...) {
+    int result;
+    va_list args;
+    va_start(args, format);
+    result = vswprintf(buffer, size, format, args);
+    va_end(args);
+    return result;
+}
+
+/** prints formatted wide character output to stdout, a file stream or a buffer using variable argument list
+ *  https://en.cppreference.com/w/c/io/vfwprintf
+ */
+libsee_export int vwprintf(wchar_t const *format, va_list vlist) {
+    int result;
+    libsee_assign(result, vwprintf, format, vlist);
+    if (result > 0) libsee_wide_stdio_count(vwprintf, (size_t)result);
+    return result;
+}
+
+libsee_export int vfwprintf(FILE *stream, wchar_t const *format, va_list vlist) {
+    int result;
+    libsee_assign(result, vfwprintf, stream, format, vlist);
+    if (result > 0) libsee_wide_stdio_count(vfwprintf, (size_t)result);
+    return result;
+}
+
+libsee_export int vswprintf(wchar_t *buffer, size_t size, wchar_t const *format, va_list vlist) {
+    int result;
+    libsee_assign(result, vswprintf, buffer, size, format, vlist);
+    if (result > 0) libsee_wide_stdio_add(vswprintf, buffer, (size_t)result);
+    return result;
+}
+
+#pragma endregion
+
+#pragma region Date and Time // Contents of `time.h`
+
+/** computes the difference between times
+ *  https://en.cppreference.com/w/c/chrono/difftime
+ */
+libsee_export double difftime(time_t end, time_t beginning) { libsee_return(difftime, double, end, beginning); }
+
+/** returns the current calendar time of the system as time since epoch
+ *  https://en.cppreference.com/w/c/chrono/time
+ */
+libsee_export time_t time(time_t *arg) { libsee_return(time, time_t, arg); }
+
+/** returns raw processor clock time since the program is started
+ *  https://en.cppreference.com/w/c/chrono/clock
+ */
+libsee_export clock_t clock(void) { libsee_return(clock, clock_t); }
+
+/** returns the calendar time in seconds and nanoseconds based on a given time base
+ *  https://en.cppreference.com/w/c/chrono/timespec_get
+ */
+libsee_export int timespec_get(struct timespec *ts, int base) { libsee_return(timespec_get, int, ts, base); }
+
+/** returns the resolution of calendar time based on a given time base
+ *  https://en.cppreference.com/w/c/chrono/timespec_getres
+ */
+libsee_export int timespec_getres(struct timespec *res, int base) { libsee_return(timespec_getres, int, res, base); }
+
+/** converts a tm object to a textual representation
+ *  https://en.cppreference.com/w/c/chrono/asctime
+ */
+libsee_export char *asctime(struct tm const *time_ptr) { libsee_return(asctime, char *, time_ptr); }
+libsee_export errno_t asctime_s(char *buf, rsize_t bufsz, struct tm const *time_ptr) {
+    libsee_return(asctime_s, errno_t, buf, bufsz, time_ptr);
+}
+
+/** converts a time_t object to a textual representation
+ *  https://en.cppreference.com/w/c/chrono/ctime
+ */
+libsee_export char *ctime(time_t const *clock) { libsee_return(ctime, char *, clock); }
+libsee_export errno_t ctime_s(char *buf, rsize_t bufsz, time_t const *clock) {
+    libsee_return(ctime_s, errno_t, buf, bufsz, clock);
+}
+
+/** converts a tm object to custom textual representation
+ *  https://en.cppreference.com/w/c/chrono/strftime
+ */
+libsee_export size_t strftime(char *s, size_t maxsize, char const *format, struct tm const *timeptr) {
+    libsee_return(strftime, size_t, s, maxsize, format, timeptr);
+}
+
+/** converts a tm object to custom wide string textual representation
+ *  https://en.cppreference.com/w/c/chrono/wcsftime
+ */
+libsee_export size_t wcsftime(wchar_t *wcs, size_t maxsize, wchar_t const *format, struct tm const *timeptr) {
+    libsee_return(wcsftime, size_t, wcs, maxsize, format, timeptr);
+}
+
+/** converts time since epoch to calendar time expressed as Coordinated Universal Time (UTC)
+ *  https://en.cppreference.com/w/c/chrono/gmtime
+ */
+libsee_export struct tm *gmtime(time_t const *timer) { libsee_return(gmtime, struct tm *, timer); }
+libsee_export struct tm *gmtime_r(time_t const *timer, struct tm *result) {
+    libsee_return(gmtime_r, struct tm *, timer, result);
+}
+libsee_export errno_t gmtime_s(time_t const *timer, struct tm *result) {
+    libsee_return(gmtime_s, errno_t, timer, result);
+}
+
+/** converts time since epoch to calendar time expressed as local time
+ *  https://en.cppreference.com/w/c/chrono/localtime
+ */
+libsee_export struct tm *localtime(time_t const *timer) { libsee_return(localtime, struct tm *, timer); }
+libsee_export struct tm *localtime_r(time_t const *timer, struct tm *result) {
+    libsee_return(localtime_r, struct tm *, timer, result);
+}
+libsee_export errno_t localtime_s(time_t const *timer, struct tm *result) {
+    libsee_return(localtime_s, errno_t, timer, result);
+}
+
+/** converts calendar time to time since epoch
+ *  https://en.cppreference.com/w/c/chrono/mktime
+ */
+libsee_export time_t mktime(struct tm *timeptr) { libsee_return(mktime, time_t, timeptr); }
+
+/*
+ *  Clocks and sleeps, which are not a part of the C standard, but are among the most frequently called
+ *  functions in latency-sensitive software. Most clocks are served by the vDSO without entering the kernel,
+ *  but the CPU-time clocks, the dynamic clocks, and all clocks on hosts with unstable clock sources
+ *  fall back to real system calls, costing an order of magnitude more.
+ */
+
+#define LIBSEE_STATIC_CLOCKS 12 // From `CLOCK_REALTIME` to `CLOCK_TAI`, with the dynamic clocks counted separately
+
+/**
+ *  @brief  Per-clock costs of `clock_gettime`, laid out per CPU core just like the main counters,
+ *          as the function is often called millions of times per second from every thread.
+ */
+typedef struct libsee_clock_stats {
+    size_t calls[LIBSEE_STATIC_CLOCKS + 1];
+    size_t cycles[LIBSEE_STATIC_CLOCKS + 1];
+} libsee_clock_stats;
+
+static libsee_clock_stats libsee_clocks[LIBSEE_MAX_THREADS] = {0};
+static libsee_histogram libsee_oversleep_nanoseconds = {0};
+
+static inline long long libsee_timespec_nanoseconds(struct timespec const *time) {
+    return (long long)time->tv_sec * 1000000000ll + (long long)time->tv_nsec;
+}
+
+long long libsee_clock_nanoseconds(clockid_t clock) {
+    struct timespec now;
+    if (libsee_apis.clock_gettime(clock, &now) != 0) return 0;
+    return libsee_timespec_nanoseconds(&now);
+}
+
+/**
+ *  @brief  Records how much longer a sleep took than was requested, due to the timer slack
+ *          and the scheduling delays. Interrupted sleeps must not be passed here.
+ */
+void libsee_oversleep_add(long long requested_deadline, long long actual_wakeup) {
+    long long overshoot = actual_wakeup - requested_deadline;
+    libsee_histogram_add(&libsee_oversleep_nanoseconds, overshoot > 0 ? (size_t)overshoot : 0);
+}
+
+/** retrieves the time of the specified clock
+ *  https://man7.org/linux/man-pages/man2/clock_gettime.2.html
+ */
+libsee_export int clock_gettime(clockid_t clock, struct timespec *time) {
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, clock_gettime, clock, time);
+    size_t slot = clock >= 0 && clock < LIBSEE_STATIC_CLOCKS ? (size_t)clock : LIBSEE_STATIC_CLOCKS;
+    libsee_clock_stats *stats = &libsee_clocks[libsee_get_cpu_index()];
+    stats->calls[slot]++;
+    stats->cycles[slot] += cycles;
+    return result;
+}
+
+libsee_export int gettimeofday(struct timeval *time, void *timezone) {
+    libsee_return(gettimeofday, int, time, timezone);
+}
+
+/** suspends the execution for an interval
+ *  https://man7.org/linux/man-pages/man2/nanosleep.2.html
+ *  https://man7.org/linux/man-pages/man2/clock_nanosleep.2.html
+ */
+libsee_export int nanosleep(struct timespec const *duration, struct timespec *remaining) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    int result;
+    libsee_assign(result, nanosleep, duration, remaining);
+    if (result == 0)
+        libsee_oversleep_add(start + libsee_timespec_nanoseconds(duration), libsee_clock_nanoseconds(CLOCK_MONOTONIC));
+    return result;
+}
+
+libsee_export int clock_nanosleep(clockid_t clock, int flags, struct timespec const *time, struct timespec *remaining) {
+    libsee_initialize_if_not();
+    long long start = flags & TIMER_ABSTIME ? 0 : libsee_clock_nanoseconds(clock);
+    int result;
+    libsee_assign(result, clock_nanosleep, clock, flags, time, remaining);
+    if (result == 0) libsee_oversleep_add(start + libsee_timespec_nanoseconds(time), libsee_clock_nanoseconds(clock));
+    return result;
+}
+
+libsee_export int usleep(useconds_t microseconds) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    int result;
+    libsee_assign(result, usleep, microseconds);
+    if (result == 0)
+        libsee_oversleep_add(start + (long long)microseconds * 1000ll, libsee_clock_nanoseconds(CLOCK_MONOTONIC));
+    return result;
+}
+
+libsee_export unsigned int sleep(unsigned int seconds) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    unsigned int result;
+    libsee_assign(result, sleep, seconds);
+    if (result == 0)
+        libsee_oversleep_add(start + (long long)seconds * 1000000000ll, libsee_clock_nanoseconds(CLOCK_MONOTONIC));
+    return result;
+}
+
+#pragma endregion
+
+#pragma region Networking // Contents of `sys/socket.h`, `poll.h`, `sys/select.h`, and `sys/epoll.h`
+
+/**
+ *  @brief  Per-descriptor socket traffic. Descriptors are reused after `close`, so the counters
+ *          accumulate over every socket that had the same number, and `opened` tells how many there were.
+ */
+typedef struct libsee_socket_stats {
+    size_t opened;
+    size_t sends;
+    size_t sent_bytes;
+    size_t receives;
+    size_t received_bytes;
+} libsee_socket_stats;
+
+static libsee_socket_stats libsee_sockets[LIBSEE_MAX_DESCRIPTORS] = {0};
+
+/**
+ *  @brief  Distributions exposing the batching opportunities: small sends, single-message
+ *          `sendmmsg`/`recvmmsg` calls, and event loops waking up for a single event.
+ */
+typedef struct libsee_batching_stats {
+    libsee_histogram bytes_per_send;
+    libsee_histogram messages_per_sendmmsg;
+    libsee_histogram messages_per_recvmmsg;
+    libsee_histogram events_per_epoll_wait;
+    libsee_histogram descriptors_per_poll; // Ready descriptors per `poll` or `select` wakeup
+} libsee_batching_stats;
+
+static libsee_batching_stats libsee_batching = {0};
+
+void libsee_socket_opened(int fd) {
+    if (fd < 0 || fd >= LIBSEE_MAX_DESCRIPTORS) return;
+    __atomic_fetch_add(&libsee_sockets[fd].opened, 1, __ATOMIC_RELAXED);
+}
+
+void libsee_socket_sent(int fd, size_t messages, size_t bytes) {
+    if (fd < 0 || fd >= LIBSEE_MAX_DESCRIPTORS) return;
+    __atomic_fetch_add(&libsee_sockets[fd].sends, messages, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&libsee_sockets[fd].sent_bytes, bytes, __ATOMIC_RELAXED);
+}
+
+void libsee_socket_received(int fd, size_t messages, size_t bytes) {
+    if (fd < 0 || fd >= LIBSEE_MAX_DESCRIPTORS) return;
+    __atomic_fetch_add(&libsee_sockets[fd].receives, messages, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&libsee_sockets[fd].received_bytes, bytes, __ATOMIC_RELAXED);
+}
+
+/*
+ *  The single-message transfers share the same pattern, so it's generated by a macro.
+ *  Failed calls are only counted as calls, and empty datagrams as messages without any bytes.
+ */
+#define libsee_socket_io(function_name, sending, fd, ...)                  \
+    do {                                                                   \
+        ssize_t _result;                                                   \
+        libsee_assign(_result, function_name, __VA_ARGS__);                \
+        if (_result < 0) return _result;                                   \
+        size_t _bytes = (size_t)_result;                                   \
+        libsee_add_bytes(function_name, _bytes);                           \
+        if (sending) {                                                     \
+            libsee_socket_sent(fd, 1, _bytes);                             \
+            libsee_histogram_add(&libsee_batching.bytes_per_send, _bytes); \
+        }                                                                  \
+        else                                                               \
+            libsee_socket_received(fd, 1, _bytes);                         \
+        return _result;                                                    \
+    } while (0)
+
+/** creates an endpoint for communication
+ *  https://man7.org/linux/man-pages/man2/socket.2.html
+ */
+libsee_export int socket(int domain, int type, int protocol) {
+    int result;
+    libsee_assign(result, socket, domain, type, protocol);
+    libsee_socket_opened(result);
+    return result;
+}
+
+libsee_export int socketpair(int domain, int type, int protocol, int fds[2]) {
+    int result;
+    libsee_assign(result, socketpair, domain, type, protocol, fds);
+    if (result == 0) libsee_socket_opened(fds[0]), libsee_socket_opened(fds[1]);
+    return result;
+}
+
+/** accepts a connection on a socket
+ *  https://man7.org/linux/man-pages/man2/accept.2.html
+ */
+libsee_export int accept(int fd, struct sockaddr *address, socklen_t *address_length) {
+    int result;
+    libsee_assign(result, accept, fd, address, address_length);
+    libsee_socket_opened(result);
+    return result;
+}
+
+libsee_export int accept4(int fd, struct sockaddr *address, socklen_t *address_length, int flags) {
+    int result;
+    libsee_assign(result, accept4, fd, address, address_length, flags);
+    libsee_socket_opened(result);
+    return result;
+}
+
+/** initiates a connection on a socket
+ *  https://man7.org/linux/man-pages/man2/connect.2.html
+ */
+libsee_export int connect(int fd, struct sockaddr const *address, socklen_t address_length) {
+    libsee_return(connect, int, fd, address, address_length);
+}
+
+/** sends a message on a socket
+ *  https://man7.org/linux/man-pages/man2/send.2.html
+ */
+libsee_export ssize_t send(int fd, void const *buffer, size_t length, int flags) {
+    libsee_socket_io(send, 1, fd, fd, buffer, length, flags);
+}
+
+libsee_export ssize_t sendto(int fd, void const *buffer, size_t length, int flags, struct sockaddr const *address,
+                             socklen_t address_length) {
+    libsee_socket_io(sendto, 1, fd, fd, buffer, length, flags, address, address_length);
+}
+
+libsee_export ssize_t sendmsg(int fd, struct msghdr const *message, int flags) {
+    libsee_socket_io(sendmsg, 1, fd, fd, message, flags);
+}
+
+/** relevant Linux @b extension, sending multiple messages with a single system call
+ *  https://man7.org/linux/man-pages/man2/sendmmsg.2.html
+ */
+libsee_export int sendmmsg(int fd, struct mmsghdr *messages, unsigned int count, int flags) {
+    int result;
+    libsee_assign(result, sendmmsg, fd, messages, count, flags);
+    if (result < 0) return result;
+    size_t bytes = 0;
+    for (int i = 0; i != result; ++i) {
+        bytes += messages[i].msg_len;
+        libsee_histogram_add(&libsee_batching.bytes_per_send, messages[i].msg_len);
+    }
+    libsee_add_bytes(sendmmsg, bytes);
+    libsee_socket_sent(fd, (size_t)result, bytes);
+    libsee_histogram_add(&libsee_batching.messages_per_sendmmsg, (size_t)result);
+    return result;
+}
+
+/** receives a message from a socket
+ *  https://man7.org/linux/man-pages/man2/recv.2.html
+ */
+libsee_export ssize_t recv(int fd, void *buffer, size_t length, int flags) {
+    libsee_socket_io(recv, 0, fd, fd, buffer, length, flags);
+}
+
+libsee_export ssize_t recvfrom(int fd, void *buffer, size_t length, int flags, struct sockaddr *address,
+                               socklen_t *address_length) {
+    libsee_socket_io(recvfrom, 0, fd, fd, buffer, length, flags, address, address_length);
+}
+
+libsee_export ssize_t recvmsg(int fd, struct msghdr *message, int flags) {
+    libsee_socket_io(recvmsg, 0, fd, fd, message, flags);
+}
+
+/** relevant Linux @b extension, receiving multiple messages with a single system call
+ *  https://man7.org/linux/man-pages/man2/recvmmsg.2.html
+ */
+libsee_export int recvmmsg(int fd, struct mmsghdr *messages, unsigned int count, int flags, struct timespec *timeout) {
+    int result;
+    libsee_assign(result, recvmmsg, fd, messages, count, flags, timeout);
+    if (result < 0) return result;
+    size_t bytes = 0;
+    for (int i = 0; i != result; ++i) bytes += messages[i].msg_len;
+    libsee_add_bytes(recvmmsg, bytes);
+    libsee_socket_received(fd, (size_t)result, bytes);
+    libsee_histogram_add(&libsee_batching.messages_per_recvmmsg, (size_t)result);
+    return result;
+}
+
+/** waits for some event on a set of file descriptors
+ *  https://man7.org/linux/man-pages/man2/poll.2.html
+ *  https://man7.org/linux/man-pages/man2/select.2.html
+ */
+libsee_export int poll(struct pollfd *fds, nfds_t count, int timeout) {
+    int result;
+    libsee_assign(result, poll, fds, count, timeout);
+    if (result >= 0) libsee_histogram_add(&libsee_batching.descriptors_per_poll, (size_t)result);
+    return result;
+}
+
+libsee_export int select(int count, fd_set *read_fds, fd_set *write_fds, fd_set *except_fds, struct timeval *timeout) {
+    int result;
+    libsee_assign(result, select, count, read_fds, write_fds, except_fds, timeout);
+    if (result >= 0) libsee_histogram_add(&libsee_batching.descriptors_per_poll, (size_t)result);
+    return result;
+}
+
+/** waits for an I/O event on an epoll file descriptor
+ *  https://man7.org/linux/man-pages/man2/epoll_wait.2.html
+ *
+ *  Wakeups returning a single event on a busy loop suggest that the work per wakeup is too small,
+ *  and that the loop would benefit from batching or busy polling.
+ */
+libsee_export int epoll_wait(int epoll_fd, struct epoll_event *events, int max_events, int timeout) {
+    int result;
+    libsee_assign(result, epoll_wait, epoll_fd, events, max_events, timeout);
+    if (result >= 0) libsee_histogram_add(&libsee_batching.events_per_epoll_wait, (size_t)result);
+    return result;
+}
+
+/** controls the interest list of an epoll file descriptor
+ *  https://man7.org/linux/man-pages/man2/epoll_ctl.2.html
+ */
+libsee_export int epoll_ctl(int epoll_fd, int operation, int fd, struct epoll_event *event) {
+    libsee_return(epoll_ctl, int, epoll_fd, operation, fd, event);
+}
+
+#pragma endregion
+
+#pragma region Processes // Contents of `unistd.h`, `spawn.h`, `stdio.h`, `stdlib.h`, and `sys/wait.h`
+
+#include <fcntl.h> // `AT_FDCWD`
+
+/**
+ *  @brief  Costs of process creation, as seen from the parent. The `fork` latency grows with the size of
+ *          the parent's page tables, so the resident set size is sampled before every call.
+ */
+typedef struct libsee_process_stats {
+    libsee_histogram resident_bytes_at_fork;
+    size_t largest_resident_bytes_at_fork;
+} libsee_process_stats;
+
+static libsee_process_stats libsee_processes = {0};
+static libsee_keyed_stats libsee_spawn_sites[LIBSEE_MAX_SPAWN_SITES] = {0};
+
+/*
+ *  Must be expanded directly inside of the exported wrapper, just like `libsee_track_call_site`.
+ *  The resident set size is stored in the `bytes` field of the keyed statistics.
+ */
+#define libsee_track_spawn_site(function_name, cycles, resident_bytes)           \
+    libsee_keyed_add(libsee_spawn_sites, LIBSEE_MAX_SPAWN_SITES, #function_name, \
+        (size_t)__builtin_return_address(0), cycles, resident_bytes)
+
+/**
+ *  @brief  Reads the resident set size from `/proc/self/statm` with raw system calls,
+ *          as the `fopen` and `read` family may be intercepted or allocate memory.
+ */
+size_t libsee_get_resident_bytes(void) {
+#if defined(__linux__)
+    long fd = syscall(SYS_openat, AT_FDCWD, "/proc/self/statm", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return 0;
+    char buffer[128];
+    long length = syscall(SYS_read, fd, buffer, sizeof(buffer));
+    syscall(SYS_close, fd);
+
+    // The second field is the number of resident pages
+    long i = 0;
+    while (i < length && buffer[i] != ' ') i++;
+    size_t pages = 0;
+    for (i++; i < length && buffer[i] >= '0' && buffer[i] <= '9'; i++)
+        pages = pages * 10 + (size_t)(buffer[i] - '0');
+    return pages * (size_t)sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+/** creates a child process by duplicating the calling process
+ *  https://man7.org/linux/man-pages/man2/fork.2.html
+ *
+ *  Unlike `fork`, `vfork` can't be wrapped: the child would return from the wrapper and clobber
+ *  its stack frame, while the suspended parent still needs it. Use `posix_spawn` instead.
+ */
+libsee_export pid_t fork(void) {
+    size_t resident_bytes = libsee_get_resident_bytes();
+    pid_t result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, fork);
+    if (result <= 0) return result; // Only the parent keeps the statistics
+    libsee_histogram_add(&libsee_processes.resident_bytes_at_fork, resident_bytes);
+    size_t largest = __atomic_load_n(&libsee_processes.largest_resident_bytes_at_fork, __ATOMIC_RELAXED);
+    while (resident_bytes > largest &&
+           !__atomic_compare_exchange_n(&libsee_processes.largest_resident_bytes_at_fork, &largest, resident_bytes, 1,
+               __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+    libsee_track_spawn_site(fork, cycles, resident_bytes);
+    return result;
+}
+
+/** spawns a process
+ *  https://man7.org/linux/man-pages/man3/posix_spawn.3.html
+ */
+libsee_export int posix_spawn(pid_t *pid, char const *path, posix_spawn_file_actions_t const *file_actions,
+                              posix_spawnattr_t const *attributes, char *const argv[], char *const envp[]) {
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, posix_spawn, pid, path, file_actions, attributes, argv, envp);
+    libsee_track_spawn_site(posix_spawn, cycles, 0);
+    return result;
+}
+
+libsee_export int posix_spawnp(pid_t *pid, char const *file, posix_spawn_file_actions_t const *file_actions,
+                               posix_spawnattr_t const *attributes, char *const argv[], char *const envp[]) {
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, posix_spawnp, pid, file, file_actions, attributes, argv, envp);
+    libsee_track_spawn_site(posix_spawnp, cycles, 0);
+    return result;
+}
+
+/** executes a program, replacing the current process image
+ *  https://man7.org/linux/man-pages/man2/execve.2.html
+ *  https://man7.org/linux/man-pages/man3/exec.3.html
+ *
+ *  Successful calls never return, so only the failed attempts are reflected in the report.
+ */
+libsee_export int execve(char const *path, char *const argv[], char *const envp[]) {
+    libsee_return(execve, int, path, argv, envp);
+}
+libsee_export int execv(char const *path, char *const argv[]) { libsee_return(execv, int, path, argv); }
+libsee_export int execvp(char const *file, char *const argv[]) { libsee_return(execvp, int, file, argv); }
+libsee_export int execvpe(char const *file, char *const argv[], char *const envp[]) {
+    libsee_return(execvpe, int, file, argv, envp);
+}
+
+/** calls the host environment's command processor
+ *  https://en.cppreference.com/w/c/program/system
+ *
+ *  The measured latency includes the whole runtime of the command.
+ */
+libsee_export int system(char const *command) {
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, system, command);
+    libsee_track_spawn_site(system, cycles, 0);
+    return result;
+}
+
+/** opens and closes a pipe stream to or from a process
+ *  https://man7.org/linux/man-pages/man3/popen.3.html
+ */
+libsee_export FILE *popen(char const *command, char const *mode) {
+    FILE *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, popen, command, mode);
+    libsee_track_spawn_site(popen, cycles, 0);
+    return result;
+}
+libsee_export int pclose(FILE *stream) {
+    libsee_stream_stats *slot = libsee_stream_find(stream, 0);
+    if (slot) __atomic_store_n(&slot->key, 1, __ATOMIC_RELEASE); // Same as in `fclose`
+    libsee_return(pclose, int, stream);
+}
+
+/** waits for a process to change state
+ *  https://man7.org/linux/man-pages/man2/wait.2.html
+ *  https://man7.org/linux/man-pages/man2/wait4.2.html
+ */
+libsee_export pid_t wait(int *status) { libsee_return(wait, pid_t, status); }
+libsee_export pid_t waitpid(pid_t pid, int *status, int options) {
+    libsee_return(waitpid, pid_t, pid, status, options);
+}
+libsee_export pid_t wait4(pid_t pid, int *status, int options, struct rusage *usage) {
+    libsee_return(wait4, pid_t, pid, status, options, usage);
+}
+
+#pragma endregion
+
+#pragma region Dynamic Loading // Contents of `dlfcn.h`
+
+typedef struct libsee_loaded_library {
+    size_t key;     // Hash of the full path, or zero for free slots
+    char name[64];  // Trailing part of the path, usually the file name
+    size_t opens;
+    size_t closes;
+    size_t cycles;
+    size_t nanoseconds;
+} libsee_loaded_library;
+
+typedef struct libsee_dynamic_loading_stats {
+    int (*main)(int, char **, char **);
+    int main_started;
+    size_t nanoseconds_before_main;        // Since the `execve`, with the resolution of the kernel clock ticks
+    size_t opens_before_main;              // Calls to `dlopen` and `dlmopen`
+    size_t open_nanoseconds_before_main;   // Time spent in them
+} libsee_dynamic_loading_stats;
+
+static libsee_dynamic_loading_stats libsee_dynamic_loading = {0};
+static libsee_loaded_library libsee_libraries[LIBSEE_MAX_LIBRARIES] = {0};
+
+/*
+ *  The real `dlopen` and `dlmopen` are the same for the base namespace, but only `dlmopen` can target the others.
+ */
+static inline void *libsee_open_in(Lmid_t namespace_id, char const *filename, int flags) {
+    return namespace_id == LM_ID_BASE ? libsee_apis.dlopen(filename, flags)
+                                      : libsee_apis.dlmopen(namespace_id, filename, flags);
+}
+
+/**
+ *  @brief  Opens a shared object on behalf of the code, that called the wrapper.
+ *
+ *  The loader applies the `DT_RUNPATH` and `DT_RPATH` of the object calling `dlopen`, and loads into its
+ *  namespace, both of which would be lost forwarding the call from LibSee. So the namespace is taken from
+ *  the caller, unless given explicitly, and the file names without slashes are tried with the real `dlopen`
+ *  in the directories the loader would search for the caller, before the plain call. The objects already
+ *  loaded under the same name are left to the plain call, as the loader matches them before any search.
+ */
+void *libsee_open_for_caller(size_t caller, int in_caller_namespace, Lmid_t namespace_id, char const *filename,
+    int flags) {
+    Dl_info info;
+    struct link_map *caller_map = NULL;
+    if (!dladdr1((void *)caller, &info, (void **)&caller_map, RTLD_DL_LINKMAP)) caller_map = NULL;
+    if (in_caller_namespace) {
+        namespace_id = LM_ID_BASE;
+        if (caller_map && dlinfo(caller_map, RTLD_DI_LMID, &namespace_id) != 0) namespace_id = LM_ID_BASE, dlerror();
+    }
+    // A failed attempt in a new namespace would still create it, and their number is limited
+    if (!caller_map || !filename || namespace_id == LM_ID_NEWLM) return libsee_open_in(namespace_id, filename, flags);
+    for (char const *it = filename; *it; ++it)
+        if (*it == '/') return libsee_open_in(namespace_id, filename, flags);
+
+    int has_search_path = 0;
+    for (ElfW(Dyn) const *entry = caller_map->l_ld; entry && entry->d_tag != DT_NULL; ++entry)
+        has_search_path |= entry->d_tag == DT_RUNPATH || entry->d_tag == DT_RPATH;
+    if (!has_search_path) return libsee_open_in(namespace_id, filename, flags);
+    void *loaded = libsee_open_in(namespace_id, filename, RTLD_LAZY | RTLD_NOLOAD);
+    if (loaded) {
+        libsee_apis.dlclose(loaded);
+        return libsee_open_in(namespace_id, filename, flags);
+    }
+    dlerror(); // Discard the error of the probe
+
+    union {
+        Dl_serinfo info;
+        char bytes[4096];
+    } search_paths;
+    Dl_serinfo sizes;
+    if (dlinfo(caller_map, RTLD_DI_SERINFOSIZE, &sizes) != 0 || sizes.dls_size > sizeof(search_paths) ||
+        (search_paths.info.dls_size = sizes.dls_size, search_paths.info.dls_cnt = sizes.dls_cnt,
+            dlinfo(caller_map, RTLD_DI_SERINFO, &search_paths.info) != 0)) {
+        dlerror();
+        return libsee_open_in(namespace_id, filename, flags);
+    }
+    char path[4096];
+    for (unsigned int i = 0; i < search_paths.info.dls_cnt; ++i) {
+        char const *directory = search_paths.info.dls_serpath[i].dls_name;
+        size_t length = 0;
+        while (*directory && length + 1 < sizeof(path)) path[length++] = *directory++;
+        if (length && length + 1 < sizeof(path)) path[length++] = '/';
+        char const *it = filename;
+        while (*it && length + 1 < sizeof(path)) path[length++] = *it++;
+        if (*it || *directory) continue; // Truncated
+        path[length] = '\0';
+        void *handle = libsee_open_in(namespace_id, path, flags);
+        if (handle) return handle;
+    }
+    dlerror(); // The plain call below reports its own error
+    return libsee_open_in(namespace_id, filename, flags);
+}
+
+/**
+ *  @brief  Attributes an opened or closed handle to the library it refers to.
+ */
+/*
+ *  Libraries are keyed by the hash of the full path alone, as only the file name is kept for the report.
+ */
+int libsee_library_matches(void const *slot, void const *identity) {
+    (void)slot, (void)identity;
+    return 1;
+}
+
+void libsee_library_fill(void *slot, void const *identity) {
+    libsee_loaded_library *library = (libsee_loaded_library *)slot;
+    // Keep the file name, dropping the directories that don't fit
+    char const *name = (char const *)identity;
+    for (char const *it = name; *it; ++it)
+        if (*it == '/' && it[1]) name = it + 1;
+    size_t name_length = 0;
+    while (name[name_length] && name_length + 1 < sizeof(library->name)) name_length++;
+    libsee_store_string(library->name, name, name_length);
+}
+
+void libsee_library_add(void *handle, size_t opens, size_t closes, size_t cycles, size_t nanoseconds) {
+    struct link_map *map = NULL;
+    if (!handle || dlinfo(handle, RTLD_DI_LINKMAP, &map) != 0 || !map || !map->l_name || !*map->l_name) return;
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    for (char const *it = map->l_name; *it; ++it) hash = (hash ^ (unsigned char)*it) * 0x100000001B3ull;
+    libsee_loaded_library *slot = (libsee_loaded_library *)libsee_shared_slot(libsee_libraries,
+        sizeof(libsee_loaded_library), LIBSEE_MAX_LIBRARIES, (size_t)hash, map->l_name, libsee_library_matches,
+        libsee_library_fill);
+    if (!slot) return;
+    __atomic_fetch_add(&slot->opens, opens, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->closes, closes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->cycles, cycles, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->nanoseconds, nanoseconds, __ATOMIC_RELAXED);
+}
+
+void libsee_library_opened(void *handle, long long start, size_t cycles) {
+    long long nanoseconds = libsee_clock_nanoseconds(CLOCK_MONOTONIC) - start;
+    if (nanoseconds < 0) nanoseconds = 0;
+    libsee_library_add(handle, 1, 0, cycles, (size_t)nanoseconds);
+    if (__atomic_load_n(&libsee_dynamic_loading.main_started, __ATOMIC_RELAXED)) return;
+    __atomic_fetch_add(&libsee_dynamic_loading.opens_before_main, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&libsee_dynamic_loading.open_nanoseconds_before_main, (size_t)nanoseconds, __ATOMIC_RELAXED);
+}
+
+/** loads a shared object
+ *  https://man7.org/linux/man-pages/man3/dlopen.3.html
+ *
+ *  The search for the caller may take several attempts, all of which count as one call.
+ */
+libsee_export void *dlopen(char const *filename, int flags) {
+    libsee_initialize_if_not();
+    size_t caller = (size_t)__builtin_return_address(0);
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    size_t cycles = libsee_get_cpu_cycle();
+    void *handle = libsee_open_for_caller(caller, 1, LM_ID_BASE, filename, flags);
+    cycles = libsee_get_cpu_cycle() - cycles;
+    libsee_add_call(dlopen, cycles);
+    libsee_library_opened(handle, start, cycles);
+    return handle;
+}
+
+libsee_export void *dlmopen(Lmid_t namespace_id, char const *filename, int flags) {
+    libsee_initialize_if_not();
+    size_t caller = (size_t)__builtin_return_address(0);
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    size_t cycles = libsee_get_cpu_cycle();
+    void *handle = libsee_open_for_caller(caller, 0, namespace_id, filename, flags);
+    cycles = libsee_get_cpu_cycle() - cycles;
+    libsee_add_call(dlmopen, cycles);
+    libsee_library_opened(handle, start, cycles);
+    return handle;
+}
+
+/** closes a shared object
+ *  https://man7.org/linux/man-pages/man3/dlclose.3.html
+ */
+libsee_export int dlclose(void *handle) {
+    libsee_initialize_if_not();
+    libsee_library_add(handle, 0, 1, 0, 0); // The handle is invalid after the call
+    libsee_return(dlclose, int, handle);
+}
+
+/**
+ *  @brief  Reads the process start time from `/proc/self/stat` with raw system calls, in nanoseconds
+ *          of the `CLOCK_BOOTTIME`, with the resolution of the kernel clock ticks.
+ */
+long long libsee_get_start_nanoseconds(void) {
+#if defined(__linux__)
+    long fd = syscall(SYS_openat, AT_FDCWD, "/proc/self/stat", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return 0;
+    char buffer[1024];
+    long length = syscall(SYS_read, fd, buffer, sizeof(buffer));
+    syscall(SYS_close, fd);
+
+    // The command name may contain spaces, so the fields are counted from its closing parenthesis,
+    // and the start time is the 22nd field, 20 fields after it
+    long i = length - 1;
+    while (i > 0 && buffer[i] != ')') i--;
+    for (int fields = 0; i < length && fields < 20; i++) fields += buffer[i] == ' ';
+    long long ticks = 0;
+    for (; i < length && buffer[i] >= '0' && buffer[i] <= '9'; i++) ticks = ticks * 10 + (buffer[i] - '0');
+    long ticks_per_second = sysconf(_SC_CLK_TCK);
+    return ticks_per_second > 0 ? ticks * (1000000000ll / ticks_per_second) : 0;
+#else
+    return 0;
+#endif
+}
+
+int libsee_main(int argc, char **argv, char **envp) {
+    long long start = libsee_get_start_nanoseconds(), now = libsee_clock_nanoseconds(CLOCK_BOOTTIME);
+    if (start && now > start) libsee_dynamic_loading.nanoseconds_before_main = (size_t)(now - start);
+    __atomic_store_n(&libsee_dynamic_loading.main_started, 1, __ATOMIC_RELEASE);
+    return libsee_dynamic_loading.main(argc, argv, envp);
+}
+
+/** starts the program, calling its `main`, and never returns
+ *  https://refspecs.linuxbase.org/LSB_3.1.1/LSB-Core-generic/LSB-Core-generic/baselib---libc-start-main-.html
+ *
+ *  The `main` is replaced with our own, marking the end of the startup, and the call isn't timed.
+ */
+libsee_export int __libc_start_main(int (*main)(int, char **, char **), int argc, char **argv, void (*init)(void),
+    void (*fini)(void), void (*rtld_fini)(void), void *stack_end) {
+    libsee_initialize_if_not();
+    libsee_dynamic_loading.main = main;
+    return libsee_apis.__libc_start_main(libsee_main, argc, argv, init, fini, rtld_fini, stack_end);
+}
+
+#pragma endregion
+
+#pragma region Filesystem Metadata // Contents of `sys/stat.h`, `unistd.h`, `dirent.h`, and `stdlib.h`
+
+/**
+ *  @brief  Per-prefix statistics of the metadata calls, keyed by the first `LIBSEE_PATH_PREFIX_DEPTH`
+ *          directories of the path, collapsing the digits just like `libsee_path_pattern`.
+ */
+typedef struct libsee_path_prefix_stats {
+    size_t key; // Hash of the pattern, or zero for free slots
+    size_t calls;
+    size_t cycles;
+    size_t stats;          // Calls of the `stat` and `access` families
+    size_t repeated_stats; // Of them, the ones querying a path already queried within the window
+    char pattern[LIBSEE_MAX_PATH_LENGTH];
+} libsee_path_prefix_stats;
+
+/**
+ *  @brief  A direct-mapped cache of the recently queried paths. Races between threads may only
+ *          misclassify a few lookups, so the entries aren't locked.
+ */
+typedef struct libsee_recent_stat {
+    size_t key; // Hash of the full path and the directory descriptor
+    size_t nanoseconds;
+} libsee_recent_stat;
+
+static libsee_path_prefix_stats libsee_path_prefixes[LIBSEE_MAX_PATH_PREFIXES] = {0};
+static libsee_recent_stat libsee_recent_stats[LIBSEE_MAX_RECENT_STATS] = {0};
+
+int libsee_is_repeated_stat(int dir_fd, char const *path) {
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    if (path[0] != '/') hash = (hash ^ (unsigned)dir_fd) * 0x100000001B3ull;
+    for (char const *it = path; *it; ++it) hash = (hash ^ (unsigned char)*it) * 0x100000001B3ull;
+    size_t key = (size_t)hash | 1;
+    struct timespec now;
+#if defined(CLOCK_MONOTONIC_COARSE)
+    libsee_apis.clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+#else
+    libsee_apis.clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+    size_t nanoseconds = (size_t)now.tv_sec * 1000000000ull + (size_t)now.tv_nsec;
+    libsee_recent_stat *entry = &libsee_recent_stats[key % LIBSEE_MAX_RECENT_STATS];
+    size_t previous_key = __atomic_exchange_n(&entry->key, key, __ATOMIC_RELAXED);
+    size_t previous_nanoseconds = __atomic_exchange_n(&entry->nanoseconds, nanoseconds, __ATOMIC_RELAXED);
+    return previous_key == key && nanoseconds - previous_nanoseconds < LIBSEE_REPEATED_STAT_MILLISECONDS * 1000000ull;
+}
+
+int libsee_path_prefix_matches(void const *slot, void const *identity) {
+    libsee_text_identity const *text = (libsee_text_identity const *)identity;
+    return libsee_stored_equal(((libsee_path_prefix_stats const *)slot)->pattern, text->text, text->length);
+}
+
+void libsee_path_prefix_fill(void *slot, void const *identity) {
+    libsee_text_identity const *text = (libsee_text_identity const *)identity;
+    libsee_store_string(((libsee_path_prefix_stats *)slot)->pattern, text->text, text->length);
+}
+
+/**
+ *  @brief  Attributes a metadata call to the prefix of its path. Relative paths are prefixed with "./",
+ *          or with "<descriptor>/", if resolved against a directory other than the current one.
+ */
+void libsee_metadata_add(int dir_fd, char const *path, size_t cycles, int is_stat) {
+    if (!path || !*path) return;
+    char prefix[LIBSEE_MAX_PATH_LENGTH * 2];
+    size_t length = 0;
+    if (path[0] != '/')
+        for (char const *it = dir_fd == AT_FDCWD ? "./" : "<descriptor>/"; *it; ++it) prefix[length++] = *it;
+    size_t prefix_end = 0, depth = 0;
+    for (size_t i = 0; path[i] && depth < LIBSEE_PATH_PREFIX_DEPTH; i++)
+        if (path[i] == '/') prefix_end = i + 1, depth += i != 0 && path[i - 1] != '/';
+    for (size_t i = 0; i != prefix_end && length + 1 < sizeof(prefix); i++) prefix[length++] = path[i];
+    prefix[length] = 0;
+
+    char pattern[LIBSEE_MAX_PATH_LENGTH];
+    length = libsee_path_pattern(prefix, pattern, LIBSEE_MAX_PATH_LENGTH);
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    for (size_t i = 0; i != length; ++i) hash = (hash ^ (unsigned char)pattern[i]) * 0x100000001B3ull;
+    libsee_text_identity identity = {pattern, length};
+    libsee_path_prefix_stats *slot = (libsee_path_prefix_stats *)libsee_shared_slot(libsee_path_prefixes,
+        sizeof(libsee_path_prefix_stats), LIBSEE_MAX_PATH_PREFIXES, (size_t)hash, &identity,
+        libsee_path_prefix_matches, libsee_path_prefix_fill);
+    if (!slot) return;
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->cycles, cycles, __ATOMIC_RELAXED);
+    if (!is_stat) return;
+    __atomic_fetch_add(&slot->stats, 1, __ATOMIC_RELAXED);
+    if (libsee_is_repeated_stat(dir_fd, path)) __atomic_fetch_add(&slot->repeated_stats, 1, __ATOMIC_RELAXED);
+}
+
+#define libsee_metadata_return(function_name, return_type, dir_fd, path, is_stat, ...)        \
+    do {                                                                                      \
+        return_type _metadata_result;                                                         \
+        size_t _metadata_cycles;                                                              \
+        libsee_assign_cycles(_metadata_result, _metadata_cycles, function_name, __VA_ARGS__); \
+        libsee_metadata_add(dir_fd, path, _metadata_cycles, is_stat);                         \
+        return _metadata_result;                                                              \
+    } while (0)
+
+/** retrieves the status of a file
+ *  https://man7.org/linux/man-pages/man2/stat.2.html
+ */
+libsee_export int stat(char const *path, struct stat *info) {
+    libsee_metadata_return(stat, int, AT_FDCWD, path, 1, path, info);
+}
+
+/** retrieves the status of a file, not following the trailing symbolic link
+ *  https://man7.org/linux/man-pages/man2/lstat.2.html
+ */
+libsee_export int lstat(char const *path, struct stat *info) {
+    libsee_metadata_return(lstat, int, AT_FDCWD, path, 1, path, info);
+}
+
+/** retrieves the status of an open file
+ *  https://man7.org/linux/man-pages/man2/fstat.2.html
+ */
+libsee_export int fstat(int fd, struct stat *info) { libsee_return(fstat, int, fd, info); }
+
+/** retrieves the status of a file, relative to a directory descriptor
+ *  https://man7.org/linux/man-pages/man2/fstatat.2.html
+ */
+libsee_export int fstatat(int dir_fd, char const *path, struct stat *info, int flags) {
+    libsee_metadata_return(fstatat, int, dir_fd, path, 1, dir_fd, path, info, flags);
+}
+
+/** retrieves the extended status of a file
+ *  https://man7.org/linux/man-pages/man2/statx.2.html
+ *
+ *  With `AT_EMPTY_PATH` and an empty path it describes the descriptor itself, and isn't attributed to any prefix.
+ */
+libsee_export int statx(int dir_fd, char const *path, int flags, unsigned int mask, struct statx *info) {
+    libsee_metadata_return(statx, int, dir_fd, path, 1, dir_fd, path, flags, mask, info);
+}
+
+/** checks the permissions of the user for a file
+ *  https://man7.org/linux/man-pages/man2/access.2.html
+ */
+libsee_export int access(char const *path, int mode) {
+    libsee_metadata_return(access, int, AT_FDCWD, path, 1, path, mode);
+}
+
+/** checks the permissions of the user for a file, relative to a directory descriptor
+ *  https://man7.org/linux/man-pages/man2/faccessat.2.html
+ */
+libsee_export int faccessat(int dir_fd, char const *path, int mode, int flags) {
+    libsee_metadata_return(faccessat, int, dir_fd, path, 1, dir_fd, path, mode, flags);
+}
+
+/** opens a directory stream
+ *  https://man7.org/linux/man-pages/man3/opendir.3.html
+ */
+libsee_export DIR *opendir(char const *path) { libsee_metadata_return(opendir, DIR *, AT_FDCWD, path, 0, path); }
+
+/** reads the next entry of a directory stream
+ *  https://man7.org/linux/man-pages/man3/readdir.3.html
+ */
+libsee_export struct dirent *readdir(DIR *directory) { libsee_return(readdir, struct dirent *, directory); }
+
+/** closes a directory stream
+ *  https://man7.org/linux/man-pages/man3/closedir.3.html
+ */
+libsee_export int closedir(DIR *directory) { libsee_return(closedir, int, directory); }
+
+/** resolves a path to its canonical absolute form, querying every component
+ *  https://man7.org/linux/man-pages/man3/realpath.3.html
+ */
+libsee_export char *realpath(char const *path, char *resolved_path) {
+    libsee_metadata_return(realpath, char *, AT_FDCWD, path, 0, path, resolved_path);
+}
+
+/** retrieves the current working directory
+ *  https://man7.org/linux/man-pages/man3/getcwd.3.html
+ */
+libsee_export char *getcwd(char *buffer, size_t size) { libsee_return(getcwd, char *, buffer, size); }
+
+/** removes a name from the filesystem
+ *  https://man7.org/linux/man-pages/man2/unlink.2.html
+ */
+libsee_export int unlink(char const *path) { libsee_metadata_return(unlink, int, AT_FDCWD, path, 0, path); }
+
+/** renames a file, attributed to the prefix of its old path
+ *  https://man7.org/linux/man-pages/man2/rename.2.html
+ */
+libsee_export int rename(char const *old_path, char const *new_path) {
+    libsee_metadata_return(rename, int, AT_FDCWD, old_path, 0, old_path, new_path);
+}
+
+/** creates a directory
+ *  https://man7.org/linux/man-pages/man2/mkdir.2.html
+ */
+libsee_export int mkdir(char const *path, mode_t mode) {
+    libsee_metadata_return(mkdir, int, AT_FDCWD, path, 0, path, mode);
+}
+
+#if defined(__GLIBC__)
+
+/** large-file variant of `stat`
+ *  https://man7.org/linux/man-pages/man2/stat.2.html
+ */
+libsee_export int stat64(char const *path, struct stat64 *info) {
+    libsee_metadata_return(stat64, int, AT_FDCWD, path, 1, path, info);
+}
+
+/** large-file variant of `lstat`
+ *  https://man7.org/linux/man-pages/man2/lstat.2.html
+ */
+libsee_export int lstat64(char const *path, struct stat64 *info) {
+    libsee_metadata_return(lstat64, int, AT_FDCWD, path, 1, path, info);
+}
+
+/** large-file variant of `fstat`
+ *  https://man7.org/linux/man-pages/man2/fstat.2.html
+ */
+libsee_export int fstat64(int fd, struct stat64 *info) { libsee_return(fstat64, int, fd, info); }
+
+/** large-file variant of `fstatat`
+ *  https://man7.org/linux/man-pages/man2/fstatat.2.html
+ */
+libsee_export int fstatat64(int dir_fd, char const *path, struct stat64 *info, int flags) {
+    libsee_metadata_return(fstatat64, int, dir_fd, path, 1, dir_fd, path, info, flags);
+}
+
+/** large-file variant of `readdir`
+ *  https://man7.org/linux/man-pages/man3/readdir.3.html
+ */
+libsee_export struct dirent64 *readdir64(DIR *directory) { libsee_return(readdir64, struct dirent64 *, directory); }
+
+#endif // defined(__GLIBC__)
+
+#pragma endregion
+
+#pragma region Environment // Contents of `stdlib.h`
+
+/**
+ *  @brief  Per-variable statistics, keyed by the name.
+ */
+typedef struct libsee_environment_variable {
+    size_t key; // Hash of the name, or zero for free slots
+    size_t lookups;
+    size_t misses; // Lookups of unset variables
+    size_t cycles;
+    size_t updates; // Calls to `setenv`, `unsetenv`, and `putenv`
+    char name[64];  // Longer names are truncated
+} libsee_environment_variable;
+
+/**
+ *  @brief  Per-call-site statistics of the lookups, keyed by the hash of the variable name and the call site,
+ *          as the variables are only matched to their names, when printing the report.
+ */
+typedef struct libsee_environment_lookup {
+    size_t key;      // Hash of the variable and the call site, or zero for free slots
+    size_t variable; // Hash of the variable name, from `libsee_environment_hash`
+    size_t origin;   // Return address in the application code
+    size_t calls;
+    size_t cycles;
+} libsee_environment_lookup;
+
+static libsee_environment_variable libsee_environment_variables[LIBSEE_MAX_ENVIRONMENT_VARIABLES] = {0};
+static libsee_environment_lookup libsee_environment_lookups[LIBSEE_MAX_CALL_SITES] = {0};
+
+int libsee_environment_matches(void const *slot, void const *identity) {
+    libsee_text_identity const *text = (libsee_text_identity const *)identity;
+    return libsee_stored_equal(((libsee_environment_variable const *)slot)->name, text->text, text->length);
+}
+
+void libsee_environment_fill(void *slot, void const *identity) {
+    libsee_text_identity const *text = (libsee_text_identity const *)identity;
+    libsee_store_string(((libsee_environment_variable *)slot)->name, text->text, text->length);
+}
+
+/**
+ *  @brief  Hashes the name as stored in the slot, so that the report can match the stored names to the hashes.
+ */
+size_t libsee_environment_hash(char const *name, size_t length) {
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    for (size_t i = 0; i != length; ++i) hash = (hash ^ (unsigned char)name[i]) * 0x100000001B3ull;
+    return (size_t)hash;
+}
+
+libsee_environment_variable *libsee_environment_slot(char const *name, size_t length, size_t *hash) {
+    if (!name) return NULL;
+    if (length >= sizeof(((libsee_environment_variable *)0)->name))
+        length = sizeof(((libsee_environment_variable *)0)->name) - 1;
+    *hash = libsee_environment_hash(name, length);
+    libsee_text_identity identity = {name, length};
+    return (libsee_environment_variable *)libsee_shared_slot(libsee_environment_variables,
+        sizeof(libsee_environment_variable), LIBSEE_MAX_ENVIRONMENT_VARIABLES, *hash, &identity,
+        libsee_environment_matches, libsee_environment_fill);
+}
+
+int libsee_environment_lookup_matches(void const *slot, void const *identity) {
+    libsee_environment_lookup const *stored = (libsee_environment_lookup const *)slot;
+    libsee_environment_lookup const *lookup = (libsee_environment_lookup const *)identity;
+    return stored->variable == lookup->variable && stored->origin == lookup->origin;
+}
+
+void libsee_environment_lookup_fill(void *slot, void const *identity) {
+    libsee_environment_lookup *stored = (libsee_environment_lookup *)slot;
+    libsee_environment_lookup const *lookup = (libsee_environment_lookup const *)identity;
+    stored->variable = lookup->variable, stored->origin = lookup->origin;
+}
+
+void libsee_environment_lookup_add(size_t variable, size_t origin, size_t cycles) {
+    unsigned long long hash = (unsigned long long)origin * 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ (hash >> 32) ^ (unsigned long long)variable) * 0xBF58476D1CE4E5B9ull;
+    libsee_environment_lookup identity = {0, variable, origin, 0, 0};
+    libsee_environment_lookup *slot = (libsee_environment_lookup *)libsee_shared_slot(libsee_environment_lookups,
+        sizeof(libsee_environment_lookup), LIBSEE_MAX_CALL_SITES, (size_t)(hash ^ (hash >> 29)), &identity,
+        libsee_environment_lookup_matches, libsee_environment_lookup_fill);
+    if (!slot) return;
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->cycles, cycles, __ATOMIC_RELAXED);
+}
+
+size_t libsee_environment_name_length(char const *name) {
+    size_t length = 0;
+    if (name)
+        while (name[length] && name[length] != '=') length++;
+    return length;
+}
+
+/*
+ *  Must be expanded directly inside of the exported wrapper, just like `libsee_track_call_site`.
+ */
+#define libsee_track_environment_lookup(name, value, cycles)                               \
+    do {                                                                                   \
+        size_t _hash;                                                                      \
+        libsee_environment_variable *_variable =                                           \
+            libsee_environment_slot(name, libsee_environment_name_length(name), &_hash);   \
+        if (!_variable) break;                                                             \
+        __atomic_fetch_add(&_variable->lookups, 1, __ATOMIC_RELAXED);                      \
+        __atomic_fetch_add(&_variable->misses, !(value), __ATOMIC_RELAXED);                \
+        __atomic_fetch_add(&_variable->cycles, cycles, __ATOMIC_RELAXED);                  \
+        libsee_environment_lookup_add(_hash, (size_t)__builtin_return_address(0), cycles); \
+    } while (0)
+
+void libsee_environment_updated(char const *name) {
+    size_t hash;
+    libsee_environment_variable *variable = libsee_environment_slot(name, libsee_environment_name_length(name), &hash);
+    if (variable) __atomic_fetch_add(&variable->updates, 1, __ATOMIC_RELAXED);
+}
+
+/** looks up an environment variable, scanning the whole `environ` array
+ *  https://man7.org/linux/man-pages/man3/getenv.3.html
+ */
+libsee_export char *getenv(char const *name) {
+    char *value;
+    size_t cycles;
+    libsee_assign_cycles(value, cycles, getenv, name);
+    libsee_track_environment_lookup(name, value, cycles);
+    return value;
+}
+
+/** looks up an environment variable, unless the program runs with elevated privileges
+ *  https://man7.org/linux/man-pages/man3/secure_getenv.3.html
+ */
+libsee_export char *secure_getenv(char const *name) {
+    char *value;
+    size_t cycles;
+    libsee_assign_cycles(value, cycles, secure_getenv, name);
+    libsee_track_environment_lookup(name, value, cycles);
+    return value;
+}
+
+/** adds or changes an environment variable, under a process-wide lock
+ *  https://man7.org/linux/man-pages/man3/setenv.3.html
+ */
+libsee_export int setenv(char const *name, char const *value, int overwrite) {
+    libsee_initialize_if_not();
+    libsee_environment_updated(name);
+    libsee_return(setenv, int, name, value, overwrite);
+}
+
+/** removes an environment variable, under a process-wide lock
+ *  https://man7.org/linux/man-pages/man3/unsetenv.3.html
+ */
+libsee_export int unsetenv(char const *name) {
+    libsee_initialize_if_not();
+    libsee_environment_updated(name);
+    libsee_return(unsetenv, int, name);
+}
+
+/** adds, changes, or removes an environment variable, given as a "NAME=value" string
+ *  https://man7.org/linux/man-pages/man3/putenv.3.html
+ */
+libsee_export int putenv(char *assignment) {
+    libsee_initialize_if_not();
+    libsee_environment_updated(assignment);
+    libsee_return(putenv, int, assignment);
+}
+
+/** removes all the environment variables
+ *  https://man7.org/linux/man-pages/man3/clearenv.3.html
+ */
+libsee_export int clearenv(void) { libsee_return(clearenv, int); }
+
+#pragma endregion
+
+#pragma region Name Resolution // Contents of `netdb.h`, `pwd.h`, and `grp.h`
+
+/**
+ *  @brief  Per-name statistics of the resolver and NSS lookups, keyed by the function and the queried name.
+ *          Every lookup after the first one is counted as repeated, as the program could have cached it.
+ */
+typedef struct libsee_resolved_name {
+    size_t key;                // Hash of the function and the name, or zero for free slots
+    char const *function_name; // Static string with the name of the intercepted function
+    size_t name_hash;          // Hash of the full name, which tells apart the long names with the same prefix
+    size_t calls;
+    size_t failures;
+    size_t nanoseconds;
+    size_t threads[8]; // First few distinct threads, that queried the name
+    libsee_histogram microseconds;
+    char name[64]; // Longer names are truncated, ending with "..."
+} libsee_resolved_name;
+
+static libsee_resolved_name libsee_resolved_names[LIBSEE_MAX_RESOLVED_NAMES] = {0};
+static libsee_keyed_stats libsee_resolver_threads[LIBSEE_MAX_THREADS] = {0};
+
+typedef struct libsee_resolved_identity {
+    char const *function_name;
+    char const *name;
+    size_t length; // Of the stored part of the name, without the truncation marker
+    int is_truncated;
+    size_t name_hash;
+} libsee_resolved_identity;
+
+static char const libsee_truncation_marker[] = "...";
+
+int libsee_resolved_name_matches(void const *slot, void const *identity) {
+    libsee_resolved_name const *resolved = (libsee_resolved_name const *)slot;
+    libsee_resolved_identity const *query = (libsee_resolved_identity const *)identity;
+    if (resolved->function_name != query->function_name || resolved->name_hash != query->name_hash) return 0;
+    if (!query->is_truncated) return libsee_stored_equal(resolved->name, query->name, query->length);
+    size_t i = 0;
+    while (i != query->length && resolved->name[i] == query->name[i]) ++i;
+    return i == query->length && libsee_names_equal(resolved->name + i, libsee_truncation_marker);
+}
+
+void libsee_resolved_name_fill(void *slot, void const *identity) {
+    libsee_resolved_name *resolved = (libsee_resolved_name *)slot;
+    libsee_resolved_identity const *query = (libsee_resolved_identity const *)identity;
+    resolved->function_name = query->function_name, resolved->name_hash = query->name_hash;
+    libsee_store_string(resolved->name, query->name, query->length);
+    if (!query->is_truncated) return;
+    libsee_store_string(resolved->name + query->length, libsee_truncation_marker, sizeof(libsee_truncation_marker) - 1);
+}
+
+/**
+ *  @brief  Finds or claims the slot for the given function and name, hashing the whole name, so that the long
+ *          names sharing the stored prefix still get separate slots, each marked as truncated.
+ */
+libsee_resolved_name *libsee_resolved_name_slot(char const *function_name, char const *name) {
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    size_t length = 0;
+    for (; name[length]; ++length) hash = (hash ^ (unsigned char)name[length]) * 0x100000001B3ull;
+    libsee_resolved_identity identity = {function_name, name, length, 0, (size_t)hash};
+    size_t capacity = sizeof(((libsee_resolved_name *)0)->name);
+    if (length >= capacity) identity.length = capacity - sizeof(libsee_truncation_marker), identity.is_truncated = 1;
+    hash = (hash ^ (unsigned long long)(size_t)function_name) * 0x100000001B3ull;
+    return (libsee_resolved_name *)libsee_shared_slot(libsee_resolved_names, sizeof(libsee_resolved_name),
+        LIBSEE_MAX_RESOLVED_NAMES, (size_t)hash, &identity, libsee_resolved_name_matches, libsee_resolved_name_fill);
+}
+
+void libsee_resolution_add(char const *function_name, char const *name, long long start, size_t cycles, int failed) {
+    long long nanoseconds = libsee_clock_nanoseconds(CLOCK_MONOTONIC) - start;
+    if (nanoseconds < 0) nanoseconds = 0;
+    size_t thread_id = libsee_get_thread_id();
+    libsee_keyed_add(libsee_resolver_threads, LIBSEE_MAX_THREADS, function_name, thread_id, cycles, 0);
+    libsee_resolved_name *slot = libsee_resolved_name_slot(function_name, name ? name : "(null)");
+    if (!slot) return;
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->failures, failed != 0, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->nanoseconds, (size_t)nanoseconds, __ATOMIC_RELAXED);
+    libsee_histogram_add(&slot->microseconds, (size_t)nanoseconds / 1000);
+    for (size_t i = 0; i < sizeof(slot->threads) / sizeof(slot->threads[0]); i++) {
+        size_t existing = __atomic_load_n(&slot->threads[i], __ATOMIC_RELAXED);
+        if (existing == thread_id) break;
+        if (existing == 0 &&
+            (__atomic_compare_exchange_n(&slot->threads[i], &existing, thread_id, 0, __ATOMIC_RELAXED,
+                 __ATOMIC_RELAXED) ||
+                existing == thread_id))
+            break;
+    }
+}
+
+/**
+ *  @brief  Formats IPv4 and IPv6 addresses without calling `inet_ntop`, with every IPv6 group spelled out.
+ */
+void libsee_format_address(struct sockaddr const *address, socklen_t address_length, char *buffer) {
+    static char const hex[] = "0123456789abcdef";
+    size_t length = 0;
+    if (address && address->sa_family == AF_INET && address_length >= sizeof(struct sockaddr_in)) {
+        unsigned char const *bytes = (unsigned char const *)&((struct sockaddr_in const *)address)->sin_addr;
+        for (size_t i = 0; i != 4; ++i) {
+            if (i) buffer[length++] = '.';
+            if (bytes[i] >= 100) buffer[length++] = (char)('0' + bytes[i] / 100);
+            if (bytes[i] >= 10) buffer[length++] = (char)('0' + bytes[i] / 10 % 10);
+            buffer[length++] = (char)('0' + bytes[i] % 10);
+        }
+    }
+    else if (address && address->sa_family == AF_INET6 && address_length >= sizeof(struct sockaddr_in6)) {
+        unsigned char const *bytes = (unsigned char const *)&((struct sockaddr_in6 const *)address)->sin6_addr;
+        for (size_t i = 0; i != 16; ++i) {
+            if (i && i % 2 == 0) buffer[length++] = ':';
+            buffer[length++] = hex[bytes[i] >> 4], buffer[length++] = hex[bytes[i] & 0xF];
+        }
+    }
+    else
+        for (char const *it = "(unknown family)"; *it; ++it) buffer[length++] = *it;
+    buffer[length] = 0;
+}
+
+/** translates a host name and a service to socket addresses, consulting `/etc/hosts`, DNS, and other NSS sources
+ *  https://man7.org/linux/man-pages/man3/getaddrinfo.3.html
+ */
+libsee_export int getaddrinfo(char const *node, char const *service, struct addrinfo const *hints,
+    struct addrinfo **results) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, getaddrinfo, node, service, hints, results);
+    libsee_resolution_add("getaddrinfo", node ? node : service, start, cycles, result != 0);
+    return result;
+}
+
+/** frees the socket addresses returned by `getaddrinfo`
+ *  https://man7.org/linux/man-pages/man3/freeaddrinfo.3.html
+ */
+libsee_export void freeaddrinfo(struct addrinfo *results) { libsee_noreturn(freeaddrinfo, results); }
+
+/** translates a socket address to a host name and a service, attributed to the numeric address
+ *  https://man7.org/linux/man-pages/man3/getnameinfo.3.html
+ */
+libsee_export int getnameinfo(struct sockaddr const *address, socklen_t address_length, char *host,
+    socklen_t host_length, char *service, socklen_t service_length, int flags) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(
+        result, cycles, getnameinfo, address, address_length, host, host_length, service, service_length, flags);
+    char name[64];
+    libsee_format_address(address, address_length, name);
+    libsee_resolution_add("getnameinfo", name, start, cycles, result != 0);
+    return result;
+}
+
+/** translates a host name to addresses, returning a pointer to static storage
+ *  https://man7.org/linux/man-pages/man3/gethostbyname.3.html
+ */
+libsee_export struct hostent *gethostbyname(char const *name) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    struct hostent *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, gethostbyname, name);
+    libsee_resolution_add("gethostbyname", name, start, cycles, result == NULL);
+    return result;
+}
+
+/** reentrant variant of `gethostbyname`
+ *  https://man7.org/linux/man-pages/man3/gethostbyname_r.3.html
+ */
+libsee_export int gethostbyname_r(char const *name, struct hostent *host, char *buffer, size_t buffer_length,
+    struct hostent **result, int *error) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    int status;
+    size_t cycles;
+    libsee_assign_cycles(status, cycles, gethostbyname_r, name, host, buffer, buffer_length, result, error);
+    libsee_resolution_add("gethostbyname_r", name, start, cycles, status != 0 || !result || !*result);
+    return status;
+}
+
+/** translates a service name to a port, consulting `/etc/services` and other NSS sources
+ *  https://man7.org/linux/man-pages/man3/getservbyname.3.html
+ */
+libsee_export struct servent *getservbyname(char const *name, char const *protocol) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    struct servent *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, getservbyname, name, protocol);
+    libsee_resolution_add("getservbyname", name, start, cycles, result == NULL);
+    return result;
+}
+
+/** looks up a user by name, consulting `/etc/passwd` and other NSS sources
+ *  https://man7.org/linux/man-pages/man3/getpwnam.3.html
+ */
+libsee_export struct passwd *getpwnam(char const *name) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    struct passwd *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, getpwnam, name);
+    libsee_resolution_add("getpwnam", name, start, cycles, result == NULL);
+    return result;
+}
+
+/** looks up a user by identifier, attributed to the decimal identifier
+ *  https://man7.org/linux/man-pages/man3/getpwuid.3.html
+ */
+libsee_export struct passwd *getpwuid(uid_t uid) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    struct passwd *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, getpwuid, uid);
+    char name[32], *digits = name + sizeof(name) - 1; // Filled from the end
+    *digits = 0;
+    do *--digits = (char)('0' + uid % 10);
+    while (uid /= 10);
+    libsee_resolution_add("getpwuid", digits, start, cycles, result == NULL);
+    return result;
+}
+
+/** looks up a group by name, consulting `/etc/group` and other NSS sources
+ *  https://man7.org/linux/man-pages/man3/getgrnam.3.html
+ */
+libsee_export struct group *getgrnam(char const *name) {
+    libsee_initialize_if_not();
+    long long start = libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+    struct group *result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, getgrnam, name);
+    libsee_resolution_add("getgrnam", name, start, cycles, result == NULL);
+    return result;
+}
+
+#pragma endregion
+
+#pragma region Memory Management // Contents of `stdlib.h`
+
+/** allocates memory
+ *  https://en.cppreference.com/w/c/memory/malloc
+ */
+libsee_export void *malloc(size_t size) { libsee_return(malloc, void *, size); }
+libsee_export void *calloc(size_t num, size_t size) { libsee_return(calloc, void *, num, size); }
+libsee_export void *realloc(void *ptr, size_t size) { libsee_return(realloc, void *, ptr, size); }
+
+/** deallocates memory
+ *  https://en.cppreference.com/w/c/memory/free
+ */
+libsee_export void free(void *ptr) { libsee_noreturn(free, ptr); }
+
+/** allocates aligned memory
+ *  https://en.cppreference.com/w/c/memory/aligned_alloc
+ */
+libsee_export void *aligned_alloc(size_t alignment, size_t size) {
+    libsee_return(aligned_alloc, void *, alignment, size);
+}
+
+#pragma endregion
+
+#pragma region Algorithms // Contents of `stdlib.h`
+
+/** sorts an array
+ *  https://en.cppreference.com/w/c/algorithm/qsort
+ *
+ *  Despite the name, neither C nor POSIX standards require this function to be implemented
+ *  using quicksort or make any complexity or stability guarantees.
+ */
+typedef struct libsee_sort_stats {
+    libsee_histogram element_sizes;
+    libsee_histogram element_counts;
+    size_t calls;                 // Shared between `qsort` and `qsort_s` to pick every N-th call for sampling
+    size_t sampled_calls;         // Calls, where the presortedness was estimated
+    size_t sampled_pairs;         // Adjacent pairs of elements compared across all sampled calls
+    size_t sampled_runs;          // Non-descending runs found across all sampled calls
+    size_t sampled_sorted;        // Sampled prefixes without a single descent
+    size_t sampled_reversed;      // Sampled prefixes consisting only of descents
+    size_t sampled_nearly_sorted; // Sampled prefixes with descents in at most 1/16 of pairs
+} libsee_sort_stats;
+
+static libsee_sort_stats libsee_qsort_stats = {0};
+
+/**
+ *  @brief  Records the shape of the input and, for every `LIBSEE_QSORT_SAMPLING_PERIOD`-th call,
+ *          counts the descents between adjacent elements of the array prefix using the user's comparator.
+ *          Exactly one of `compare` and `compare_s` is expected to be non-NULL.
+ */
+void libsee_sample_sortedness(void const *base, size_t count, size_t size, int (*compare)(void const *, void const *),
+    int (*compare_s)(void const *, void const *, void *), void *context) {
+    libsee_sort_stats *stats = &libsee_qsort_stats;
+    libsee_histogram_add(&stats->element_sizes, size);
+    libsee_histogram_add(&stats->element_counts, count);
+    size_t call_index = __atomic_fetch_add(&stats->calls, 1, __ATOMIC_RELAXED);
+    if (call_index % LIBSEE_QSORT_SAMPLING_PERIOD != 0 || count < 2 || !base) return;
+
+    size_t pairs = count - 1 < LIBSEE_QSORT_SAMPLED_PAIRS ? count - 1 : LIBSEE_QSORT_SAMPLED_PAIRS;
+    size_t descents = 0;
+    char const *element = (char const *)base;
+    for (size_t i = 0; i != pairs; ++i, element += size) {
+        int order = compare ? compare(element, element + size) : compare_s(element, element + size, context);
+        descents += order > 0;
+    }
+
+    __atomic_fetch_add(&stats->sampled_calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->sampled_pairs, pairs, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->sampled_runs, descents + 1, __ATOMIC_RELAXED);
+    if (descents == 0) __atomic_fetch_add(&stats->sampled_sorted, 1, __ATOMIC_RELAXED);
+    else if (descents == pairs) __atomic_fetch_add(&stats->sampled_reversed, 1, __ATOMIC_RELAXED);
+    else if (descents * 16 <= pairs) __atomic_fetch_add(&stats->sampled_nearly_sorted, 1, __ATOMIC_RELAXED);
+}
+
+libsee_export void qsort(void *base, size_t count, size_t size, int (*compare)(void const *, void const *)) {
+    libsee_sample_sortedness(base, count, size, compare, NULL, NULL);
+    libsee_noreturn(qsort, base, count, size, compare);
+}
+libsee_export void qsort_s(void *base, rsize_t count, rsize_t size, int (*compare)(void const *, void const *, void *),
+    void *context) {
+    libsee_sample_sortedness(base, count, size, NULL, compare, context);
+    libsee_noreturn(qsort_s, base, count, size, compare, context);
+}
+
+/** searches an array for a given value
+ *  https://en.cppreference.com/w/c/algorithm/bsearch
+ *
+ *  Despite the name, neither C nor POSIX standards require this function to be implemented
+ *  using binary search or make any complexity guarantees.
+ */
+libsee_export void *bsearch(void const *key, void const *base, size_t count, size_t size,
+    int (*compare)(void const *, void const *)) {
+    libsee_return(bsearch, void *, key, base, count, size, compare);
+}
+libsee_export void *bsearch_s(void const *key, void const *base, rsize_t count, rsize_t size,
+    int (*compare)(void const *, void const *, void *), void *context) {
+    libsee_return(bsearch_s, void *, key, base, count, size, compare, context);
+}
+
+/** search tables from POSIX and GNU extensions
+ *  https://man7.org/linux/man-pages/man3/hsearch.3.html
+ *  https://man7.org/linux/man-pages/man3/tsearch.3.html
+ *  https://man7.org/linux/man-pages/man3/lsearch.3.html
+ *
+ *  Comparators passed to the tree and linear searches are wrapped into a trampoline counting the invocations,
+ *  to spot the linear scans and the trees growing deeper than expected. The hash tables can't grow in-place,
+ *  and their probe sequences get dramatically longer as they fill up, so the peak load factor is tracked.
+ */
+typedef struct libsee_search_stats {
+    libsee_histogram tree_comparisons;   // Comparator calls per `tsearch`, `tfind`, or `tdelete`
+    libsee_histogram linear_comparisons; // Comparator calls per `lsearch` or `lfind`
+    size_t hash_capacity;                // Requested by the last `hcreate`, approximate, as glibc rounds it up
+    size_t hash_entries;                 // Inserted into the global table since the last `hcreate`
+    size_t hash_overflows;               // Insertions failed due to a full table
+    size_t peak_load_per_mille;          // Highest load factor of any table, in thousandths
+} libsee_search_stats;
+
+static libsee_search_stats libsee_search = {0};
+
+typedef int (*libsee_comparator_t)(void const *, void const *);
+static __thread libsee_comparator_t libsee_user_comparator = NULL;
+static __thread size_t libsee_comparisons = 0;
+
+int libsee_counting_comparator(void const *a, void const *b) {
+    libsee_comparisons++;
+    return libsee_user_comparator(a, b);
+}
+
+void libsee_hash_load_add(size_t entries, size_t capacity) {
+    if (!capacity) return;
+    size_t load_per_mille = entries * 1000 / capacity;
+    size_t peak = __atomic_load_n(&libsee_search.peak_load_per_mille, __ATOMIC_RELAXED);
+    while (load_per_mille > peak &&
+           !__atomic_compare_exchange_n(
+               &libsee_search.peak_load_per_mille, &peak, load_per_mille, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+}
+
+/*
+ *  Every comparator-based search replaces the user's comparator with the trampoline, stashing the outer state,
+ *  in case the comparator itself performs a search. The trampoline call is included into the measured time.
+ */
+#define libsee_counted_search(function_name, return_type, histogram, compare, ...)           \
+    do {                                                                                     \
+        libsee_comparator_t _outer_comparator = libsee_user_comparator;                      \
+        size_t _outer_comparisons = libsee_comparisons;                                      \
+        libsee_user_comparator = (compare), libsee_comparisons = 0;                          \
+        return_type _result;                                                                 \
+        libsee_assign(_result, function_name, __VA_ARGS__);                                  \
+        libsee_histogram_add(histogram, libsee_comparisons);                                 \
+        libsee_user_comparator = _outer_comparator, libsee_comparisons = _outer_comparisons; \
+        return _result;                                                                      \
+    } while (0)
+
+libsee_export int hcreate(size_t capacity) {
+    int result;
+    libsee_assign(result, hcreate, capacity);
+    if (result) libsee_search.hash_capacity = capacity, libsee_search.hash_entries = 0;
+    return result;
+}
+
+libsee_export ENTRY *hsearch(ENTRY item, ACTION action) {
+    // The global table is hidden, so the insertions are told apart from the hits by an untimed lookup
+    libsee_initialize_if_not();
+    int existed = action == ENTER && libsee_apis.hsearch(item, FIND) != NULL;
+    ENTRY *result;
+    libsee_assign(result, hsearch, item, action);
+    if (action != ENTER) return result;
+    if (!result) __atomic_fetch_add(&libsee_search.hash_overflows, 1, __ATOMIC_RELAXED);
+    else if (!existed)
+        libsee_hash_load_add(__atomic_add_fetch(&libsee_search.hash_entries, 1, __ATOMIC_RELAXED),
+            libsee_search.hash_capacity);
+    return result;
+}
+
+libsee_export void hdestroy(void) { libsee_noreturn(hdestroy); }
+
+libsee_export int hcreate_r(size_t capacity, struct hsearch_data *table) {
+    libsee_return(hcreate_r, int, capacity, table);
+}
+
+libsee_export int hsearch_r(ENTRY item, ACTION action, ENTRY **found, struct hsearch_data *table) {
+    int result;
+    libsee_assign(result, hsearch_r, item, action, found, table);
+    if (action != ENTER) return result;
+    if (!result) __atomic_fetch_add(&libsee_search.hash_overflows, 1, __ATOMIC_RELAXED);
+    else libsee_hash_load_add(table->filled, table->size);
+    return result;
+}
+
+libsee_export void hdestroy_r(struct hsearch_data *table) { libsee_noreturn(hdestroy_r, table); }
+
+libsee_export void *tsearch(void const *key, void **root, libsee_comparator_t compare) {
+    libsee_counted_search(tsearch, void *, &libsee_search.tree_comparisons, compare, key, root,
+        libsee_counting_comparator);
+}
+
+libsee_export void *tfind(void const *key, void *const *root, libsee_comparator_t compare) {
+    libsee_counted_search(tfind, void *, &libsee_search.tree_comparisons, compare, key, root,
+        libsee_counting_comparator);
+}
+
+libsee_export void *tdelete(void const *key, void **root, libsee_comparator_t compare) {
+    libsee_counted_search(tdelete, void *, &libsee_search.tree_comparisons, compare, key, root,
+        libsee_counting_comparator);
+}
+
+libsee_export void twalk(void const *root, void (*action)(void const *node, VISIT order, int depth)) {
+    libsee_noreturn(twalk, root, action);
+}
+
+libsee_export void *lsearch(void const *key, void *base, size_t *count, size_t size, libsee_comparator_t compare) {
+    libsee_counted_search(lsearch, void *, &libsee_search.linear_comparisons, compare, key, base, count, size,
+        libsee_counting_comparator);
+}
+
+libsee_export void *lfind(void const *key, void const *base, size_t *count, size_t size, libsee_comparator_t compare) {
+    libsee_counted_search(lfind, void *, &libsee_search.linear_comparisons, compare, key, base, count, size,
+        libsee_counting_comparator);
+}
+
+/** pattern matching from POSIX
+ *  https://man7.org/linux/man-pages/man3/regcomp.3.html
+ *  https://man7.org/linux/man-pages/man3/fnmatch.3.html
+ *  https://man7.org/linux/man-pages/man3/glob.3.html
+ *  https://man7.org/linux/man-pages/man3/wordexp.3.html
+ *
+ *  All the costs are keyed by the pattern string, to spot the same expression being compiled in a loop,
+ *  and to compare the matching throughput of different expressions in cycles per byte of input.
+ *  A `regex_t` object only remembers the compiled automaton, so the addresses of compiled objects are
+ *  bound to their patterns in a separate table, until `regfree` releases them.
+ */
+typedef struct libsee_pattern_stats {
+    size_t key;                // Hash of the function name and the pattern, or zero for free slots
+    char const *function_name; // Either "regcomp", "fnmatch", "glob", or "wordexp"
+    size_t compiles;
+    size_t compile_cycles;
+    size_t calls; // Matches against compiled expressions, or standalone calls
+    size_t cycles;
+    size_t bytes;
+    size_t hits; // Successful matches, or the paths and words produced by `glob` and `wordexp`
+    size_t jit_calls; // Matches served by the machine code generated by the PCRE2 JIT
+    char pattern[LIBSEE_MAX_PATTERN_LENGTH];
+} libsee_pattern_stats;
+
+typedef struct libsee_regex_binding {
+    size_t key; // Address of the compiled object, zero for free slots, or one for released ones
+    libsee_pattern_stats *pattern;
+    int jit; // Set once the compiled object is translated into machine code, only by PCRE2
+} libsee_regex_binding;
+
+static libsee_pattern_stats libsee_patterns[LIBSEE_MAX_PATTERNS] = {0};
+static libsee_regex_binding libsee_regexes[LIBSEE_MAX_PATTERNS] = {0};
+
+typedef struct libsee_pattern_identity {
+    char const *function_name;
+    char const *pattern;
+    size_t length;
+} libsee_pattern_identity;
+
+int libsee_pattern_matches(void const *slot, void const *identity) {
+    libsee_pattern_stats const *stats = (libsee_pattern_stats const *)slot;
+    libsee_pattern_identity const *query = (libsee_pattern_identity const *)identity;
+    return libsee_names_equal(stats->function_name, query->function_name) &&
+           libsee_stored_equal(stats->pattern, query->pattern, query->length);
+}
+
+void libsee_pattern_fill(void *slot, void const *identity) {
+    libsee_pattern_stats *stats = (libsee_pattern_stats *)slot;
+    libsee_pattern_identity const *query = (libsee_pattern_identity const *)identity;
+    stats->function_name = query->function_name;
+    libsee_store_string(stats->pattern, query->pattern, query->length);
+}
+
+libsee_pattern_stats *libsee_pattern_slot(char const *function_name, char const *pattern, size_t pattern_length) {
+    // Long patterns are truncated, keeping the head and marking the cut with an ellipsis,
+    // while the control characters are replaced to keep the report on one line per pattern
+    char truncated[LIBSEE_MAX_PATTERN_LENGTH];
+    size_t length = 0;
+    for (; length != pattern_length && length + 1 < LIBSEE_MAX_PATTERN_LENGTH; length++)
+        truncated[length] = (unsigned char)pattern[length] < ' ' ? '?' : pattern[length];
+    if (length != pattern_length) truncated[length - 1] = truncated[length - 2] = truncated[length - 3] = '.';
+    truncated[length] = 0;
+
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    for (char const *it = function_name; *it; ++it) hash = (hash ^ (unsigned char)*it) * 0x100000001B3ull;
+    for (size_t i = 0; i != length; ++i) hash = (hash ^ (unsigned char)truncated[i]) * 0x100000001B3ull;
+    libsee_pattern_identity identity = {function_name, truncated, length};
+    return (libsee_pattern_stats *)libsee_shared_slot(libsee_patterns, sizeof(libsee_pattern_stats),
+        LIBSEE_MAX_PATTERNS, (size_t)hash, &identity, libsee_pattern_matches, libsee_pattern_fill);
+}
+
+/**
+ *  @brief  Finds the binding of a compiled expression, or claims one for it, reusing the released slots.
+ */
+libsee_regex_binding *libsee_regex_slot(void const *compiled, int claim) {
+    size_t key = (size_t)compiled;
+    unsigned long long hash = (unsigned long long)key * 0x9E3779B97F4A7C15ull;
+    size_t start = (size_t)(hash ^ (hash >> 32));
+    libsee_regex_binding *released = NULL;
+    for (size_t probe = 0; probe < LIBSEE_MAX_PATTERNS; probe++) {
+        libsee_regex_binding *slot = &libsee_regexes[(start + probe) % LIBSEE_MAX_PATTERNS];
+        size_t existing = __atomic_load_n(&slot->key, __ATOMIC_ACQUIRE);
+        if (existing == key) return slot;
+        if (existing == 1 && !released) released = slot;
+        if (existing != 0) continue;
+        if (!claim) return NULL;
+        if (released) slot = released, existing = 1;
+        if (__atomic_compare_exchange_n(&slot->key, &existing, key, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            return slot;
+        probe--, released = NULL; // Lost the race, retry from the same position
+    }
+    return NULL;
+}
+
+libsee_export int regcomp(regex_t *regex, char const *pattern, int flags) {
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, regcomp, regex, pattern, flags);
+    libsee_pattern_stats *slot = libsee_pattern_slot("regcomp", pattern, libsee_apis.strlen(pattern));
+    if (slot) {
+        __atomic_fetch_add(&slot->compiles, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&slot->compile_cycles, cycles, __ATOMIC_RELAXED);
+    }
+    libsee_regex_binding *binding = result == 0 ? libsee_regex_slot(regex, 1) : NULL;
+    if (binding) binding->pattern = slot, binding->jit = 0;
+    return result;
+}
+
+// The matches array is declared exactly like in `regex.h`, to avoid the `-Wvla-parameter` mismatch
+libsee_export int regexec(regex_t const *regex, char const *string, size_t count,
+    regmatch_t matches[_Restrict_arr_ _REGEX_NELTS(count)], int flags) {
+    // With `REG_STARTEND` only the range in the first match is scanned, and the string may be unterminated,
+    // but the call overwrites that range with the first match, so it's captured beforehand
+    size_t bytes = (flags & REG_STARTEND) ? (size_t)(matches[0].rm_eo - matches[0].rm_so) : 0;
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, regexec, regex, string, count, matches, flags);
+    if (!(flags & REG_STARTEND)) bytes = libsee_apis.strlen(string);
+    libsee_add_bytes(regexec, bytes);
+    libsee_regex_binding *binding = libsee_regex_slot(regex, 0);
+    libsee_pattern_stats *slot = binding ? binding->pattern : NULL;
+    if (!slot) return result;
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->cycles, cycles, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->bytes, bytes, __ATOMIC_RELAXED);
+    if (result == 0) __atomic_fetch_add(&slot->hits, 1, __ATOMIC_RELAXED);
+    return result;
+}
+
+libsee_export size_t regerror(int code, regex_t const *regex, char *buffer, size_t capacity) {
+    libsee_return(regerror, size_t, code, regex, buffer, capacity);
+}
+
+libsee_export void regfree(regex_t *regex) {
+    libsee_noreturn(regfree, regex);
+    libsee_regex_binding *binding = libsee_regex_slot(regex, 0);
+    if (binding) __atomic_store_n(&binding->key, 1, __ATOMIC_RELEASE);
+}
+
+/**
+ *  @brief  Attributes a standalone matching call to its pattern, as those compile it every time.
+ */
+void libsee_pattern_add(char const *function_name, char const *pattern, size_t cycles, size_t bytes, size_t hits) {
+    libsee_pattern_stats *slot = libsee_pattern_slot(function_name, pattern, libsee_apis.strlen(pattern));
+    if (!slot) return;
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->cycles, cycles, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->bytes, bytes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->hits, hits, __ATOMIC_RELAXED);
+}
+
+libsee_export int fnmatch(char const *pattern, char const *string, int flags) {
+    int result;
+    size_t cycles;
+    libsee_assign_cycles(result, cycles, fnmatch, pattern, string, flags);
+    size_t bytes = libsee_apis.strlen(string);
+    libsee_add_bytes(fnmatch, bytes);
+    libsee_pattern_add("fnmatch", pattern, cycles, bytes, result == 0);
+    return result;
+}
+
+libsee_export int glob(char const *pattern, int flags, int (*on_error)(char const *path, int code), glob_t *paths) {
+    int result;
+    size_t cycles;
+    size_t appended_to = (flags & GLOB_APPEND) ? paths->gl_pathc : 0;
+    libsee_assign_cycles(result, cycles, glob, pattern, flags, on_error, paths);
+    libsee_pattern_add("glob", pattern, cycles, 0, result == 0 ? paths->gl_pathc - appended_to : 0);
+    return result;
+}
+
+libsee_export void globfree(glob_t *paths) { libsee_noreturn(globfree, paths); }
+
+libsee_export int wordexp(char const *words, wordexp_t *expansion, int flags) {
+    int result;
+    size_t cycles;
+    size_t appended_to = (flags & WRDE_APPEND) ? expansion->we_wordc : 0;
+    libsee_assign_cycles(result, cycles, wordexp, words, expansion, flags);
+    size_t bytes = libsee_apis.strlen(words);
+    libsee_add_bytes(wordexp, bytes);
+    libsee_pattern_add("wordexp", words, cycles, bytes, result == 0 ? expansion->we_wordc - appended_to : 0);
+    return result;
+}
+
+libsee_export void wordfree(wordexp_t *expansion) { libsee_noreturn(wordfree, expansion); }
+
+#if LIBSEE_PCRE2
+
+/** PCRE2 with 8-bit code units
+ *  https://www.pcre.org/current/doc/html/pcre2api.html
+ *
+ *  Compiled patterns share the pattern table and the bindings with the POSIX regular expressions.
+ *  Matches are attributed to the JIT either when explicitly using `pcre2_jit_match_8`, or when using
+ *  `pcre2_match_8` on a successfully JIT-compiled pattern without the `PCRE2_NO_JIT` option.
+ *  Match data blocks are counted separately, as creating one per match is a common and costly mistake.
+ *  PCRE2 calls its own exported functions, like `pcre2_jit_match_8` from `pcre2_match_8`, and those
+ *  nested calls are forwarded without being recorded.
+ */
+typedef struct libsee_pcre2_stats {
+    size_t match_data_creations;
+    size_t match_data_releases;
+    size_t jit_compile_failures;
+} libsee_pcre2_stats;
+
+static libsee_pcre2_stats libsee_pcre2 = {0};
+
+libsee_export struct pcre2_real_code_8 *pcre2_compile_8(uint8_t const *pattern, size_t length, uint32_t options,
+    int *error_code, size_t *error_offset, struct pcre2_real_compile_context_8 *context) {
+    struct pcre2_real_code_8 *result;
+    size_t cycles;
+    libsee_module_assign_cycles(
+        result, cycles, pcre2_compile_8, pattern, length, options, error_code, error_offset, context);
+    if (libsee_module_depth) return result;
+    if (length == PCRE2_ZERO_TERMINATED) length = libsee_apis.strlen((char const *)pattern);
+    libsee_pattern_stats *slot = libsee_pattern_slot("pcre2_compile_8", (char const *)pattern, length);
+    if (slot) {
+        __atomic_fetch_add(&slot->compiles, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&slot->compile_cycles, cycles, __ATOMIC_RELAXED);
+    }
+    libsee_regex_binding *binding = result ? libsee_regex_slot(result, 1) : NULL;
+    if (binding) binding->pattern = slot, binding->jit = 0;
+    return result;
+}
+
+libsee_export void pcre2_code_free_8(struct pcre2_real_code_8 *code) {
+    libsee_module_noreturn(pcre2_code_free_8, code);
+    libsee_regex_binding *binding = code ? libsee_regex_slot(code, 0) : NULL;
+    if (binding) __atomic_store_n(&binding->key, 1, __ATOMIC_RELEASE);
+}
+
+libsee_export int pcre2_jit_compile_8(struct pcre2_real_code_8 *code, uint32_t options) {
+    int result;
+    libsee_module_assign(result, pcre2_jit_compile_8, code, options);
+    if (libsee_module_depth) return result;
+    libsee_regex_binding *binding = libsee_regex_slot(code, 0);
+    if (result == 0 && binding) binding->jit = 1;
+    if (result != 0) __atomic_fetch_add(&libsee_pcre2.jit_compile_failures, 1, __ATOMIC_RELAXED);
+    return result;
+}
+
+/*
+ *  Both matching functions share the signature, and differ only in the use of the JIT.
+ *  Only the part of the subject after the starting offset is counted as scanned.
+ */
+#define libsee_pcre2_match(function_name, always_jit, code, subject, length, offset, options, ...)              \
+    do {                                                                                                        \
+        int _result;                                                                                            \
+        size_t _cycles;                                                                                         \
+        libsee_module_assign_cycles(                                                                            \
+            _result, _cycles, function_name, code, subject, length, offset, options, __VA_ARGS__);              \
+        if (libsee_module_depth) return _result;                                                                \
+        size_t _bytes = (length == PCRE2_ZERO_TERMINATED ? libsee_apis.strlen((char const *)subject) : length); \
+        _bytes = _bytes > offset ? _bytes - offset : 0;                                                         \
+        libsee_add_bytes(function_name, _bytes);                                                                \
+        libsee_regex_binding *_binding = libsee_regex_slot(code, 0);                                            \
+        libsee_pattern_stats *_slot = _binding ? _binding->pattern : NULL;                                      \
+        if (!_slot) return _result;                                                                             \
+        __atomic_fetch_add(&_slot->calls, 1, __ATOMIC_RELAXED);                                                 \
+        __atomic_fetch_add(&_slot->cycles, _cycles, __ATOMIC_RELAXED);                                          \
+        __atomic_fetch_add(&_slot->bytes, _bytes, __ATOMIC_RELAXED);                                            \
+        if (_result >= 0) __atomic_fetch_add(&_slot->hits, 1, __ATOMIC_RELAXED);                                \
+        if (always_jit || (_binding->jit && !(options & PCRE2_NO_JIT)))                                         \
+            __atomic_fetch_add(&_slot->jit_calls, 1, __ATOMIC_RELAXED);                                         \
+        return _result;                                                                                         \
+    } while (0)
+
+libsee_export int pcre2_match_8(struct pcre2_real_code_8 const *code, uint8_t const *subject, size_t length,
+    size_t offset, uint32_t options, struct pcre2_real_match_data_8 *match_data,
+    struct pcre2_real_match_context_8 *context) {
+    libsee_pcre2_match(pcre2_match_8, 0, code, subject, length, offset, options, match_data, context);
+}
+
+libsee_export int pcre2_jit_match_8(struct pcre2_real_code_8 const *code, uint8_t const *subject, size_t length,
+    size_t offset, uint32_t options, struct pcre2_real_match_data_8 *match_data,
+    struct pcre2_real_match_context_8 *context) {
+    libsee_pcre2_match(pcre2_jit_match_8, 1, code, subject, length, offset, options, match_data, context);
+}
+
+libsee_export struct pcre2_real_match_data_8 *pcre2_match_data_create_8(
+    uint32_t pairs, struct pcre2_real_general_context_8 *context) {
+    struct pcre2_real_match_data_8 *result;
+    libsee_module_assign(result, pcre2_match_data_create_8, pairs, context);
+    if (!libsee_module_depth) __atomic_fetch_add(&libsee_pcre2.match_data_creations, 1, __ATOMIC_RELAXED);
+    return result;
+}
+
+libsee_export struct pcre2_real_match_data_8 *pcre2_match_data_create_from_pattern_8(
+    struct pcre2_real_code_8 const *code, struct pcre2_real_general_context_8 *context) {
+    struct pcre2_real_match_data_8 *result;
+    libsee_module_assign(result, pcre2_match_data_create_from_pattern_8, code, context);
+    if (!libsee_module_depth) __atomic_fetch_add(&libsee_pcre2.match_data_creations, 1, __ATOMIC_RELAXED);
+    return result;
+}
+
+libsee_export void pcre2_match_data_free_8(struct pcre2_real_match_data_8 *match_data) {
+    libsee_module_noreturn(pcre2_match_data_free_8, match_data);
+    if (match_data && !libsee_module_depth)
+        __atomic_fetch_add(&libsee_pcre2.match_data_releases, 1, __ATOMIC_RELAXED);
+}
+
+#endif // LIBSEE_PCRE2
+
+#if LIBSEE_BLAS
+
+/** BLAS, in both the C and the Fortran interfaces
+ *  https://www.netlib.org/blas/
+ *  https://www.netlib.org/blas/blast-forum/cinterface.pdf
+ *
+ *  The time of every call is converted into the achieved FLOP/s, using the textbook operation counts:
+ *  2MNK for matrix multiplications, 2MN for matrix-vector products, and 2N for vector operations.
+ *  Calls are aggregated by the routine and the dimensions rounded up to powers of two, so that many
+ *  tiny multiplications, running far below the throughput of the large ones, stand out in the report.
+ *  Some CBLAS implementations forward to the Fortran symbols, so the nested calls are not recorded.
+ *  Fortran arguments are passed by reference, and the hidden lengths of the character arguments are omitted.
+ */
+typedef struct libsee_blas_shape {
+    size_t key;          // Hash of the routine and the dimension classes, or zero for free slots
+    char const *routine; // Shared by the C and Fortran interfaces, like "dgemm"
+    unsigned char rows_log2, columns_log2, depth_log2;
+    size_t calls;
+    size_t flops;
+    size_t cycles;
+    size_t nanoseconds;
+} libsee_blas_shape;
+
+static libsee_blas_shape libsee_blas_shapes[LIBSEE_MAX_BLAS_SHAPES] = {0};
+
+static inline unsigned char libsee_ceil_log2(long long value) {
+    unsigned char log2 = 0;
+    while (log2 < 63 && (1ll << log2) < value) ++log2;
+    return log2;
+}
+
+int libsee_blas_shape_matches(void const *slot, void const *identity) {
+    libsee_blas_shape const *shape = (libsee_blas_shape const *)slot, *query = (libsee_blas_shape const *)identity;
+    return libsee_names_equal(shape->routine, query->routine) && shape->rows_log2 == query->rows_log2 &&
+           shape->columns_log2 == query->columns_log2 && shape->depth_log2 == query->depth_log2;
+}
+
+void libsee_blas_shape_fill(void *slot, void const *identity) {
+    libsee_blas_shape *shape = (libsee_blas_shape *)slot;
+    libsee_blas_shape const *query = (libsee_blas_shape const *)identity;
+    shape->routine = query->routine;
+    shape->rows_log2 = query->rows_log2, shape->columns_log2 = query->columns_log2;
+    shape->depth_log2 = query->depth_log2;
+}
+
+/**
+ *  @brief  Starts timing a BLAS call, returning the wall-clock time, as the libraries are often multi-threaded.
+ */
+long long libsee_blas_enter(void) {
+    libsee_initialize_if_not();
+    return libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+}
+
+void libsee_blas_leave(long long start, char const *routine, long long rows, long long columns, long long depth,
+    size_t flops, size_t cycles) {
+    long long nanoseconds = libsee_clock_nanoseconds(CLOCK_MONOTONIC) - start;
+    if (libsee_module_depth) return;
+    unsigned char rows_log2 = libsee_ceil_log2(rows), columns_log2 = libsee_ceil_log2(columns),
+                  depth_log2 = libsee_ceil_log2(depth);
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    for (char const *it = routine; *it; ++it) hash = (hash ^ (unsigned char)*it) * 0x100000001B3ull;
+    hash = (hash ^ rows_log2) * 0x100000001B3ull;
+    hash = (hash ^ columns_log2) * 0x100000001B3ull;
+    hash = (hash ^ depth_log2) * 0x100000001B3ull;
+    libsee_blas_shape identity = {0, routine, rows_log2, columns_log2, depth_log2, 0, 0, 0, 0};
+    libsee_blas_shape *slot = (libsee_blas_shape *)libsee_shared_slot(libsee_blas_shapes, sizeof(libsee_blas_shape),
+        LIBSEE_MAX_BLAS_SHAPES, (size_t)hash, &identity, libsee_blas_shape_matches, libsee_blas_shape_fill);
+    if (!slot) return;
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->flops, flops, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->cycles, cycles, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->nanoseconds, nanoseconds > 0 ? (size_t)nanoseconds : 0, __ATOMIC_RELAXED);
+}
+
+libsee_export void cblas_sgemm(int layout, int transpose_a, int transpose_b, int m, int n, int k, float alpha,
+    float const *a, int lda, float const *b, int ldb, float beta, float *c, int ldc) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, cblas_sgemm, layout, transpose_a, transpose_b, m, n, k, alpha, a, lda, b, ldb,
+        beta, c, ldc);
+    libsee_blas_leave(start, "sgemm", m, n, k, 2ull * m * n * k, cycles);
+}
+
+libsee_export void cblas_dgemm(int layout, int transpose_a, int transpose_b, int m, int n, int k, double alpha,
+    double const *a, int lda, double const *b, int ldb, double beta, double *c, int ldc) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, cblas_dgemm, layout, transpose_a, transpose_b, m, n, k, alpha, a, lda, b, ldb,
+        beta, c, ldc);
+    libsee_blas_leave(start, "dgemm", m, n, k, 2ull * m * n * k, cycles);
+}
+
+libsee_export void cblas_sgemv(int layout, int transpose, int m, int n, float alpha, float const *a, int lda,
+    float const *x, int incx, float beta, float *y, int incy) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, cblas_sgemv, layout, transpose, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    libsee_blas_leave(start, "sgemv", m, n, 1, 2ull * m * n, cycles);
+}
+
+libsee_export void cblas_dgemv(int layout, int transpose, int m, int n, double alpha, double const *a, int lda,
+    double const *x, int incx, double beta, double *y, int incy) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, cblas_dgemv, layout, transpose, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    libsee_blas_leave(start, "dgemv", m, n, 1, 2ull * m * n, cycles);
+}
+
+libsee_export void cblas_saxpy(int n, float alpha, float const *x, int incx, float *y, int incy) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, cblas_saxpy, n, alpha, x, incx, y, incy);
+    libsee_blas_leave(start, "saxpy", n, 1, 1, 2ull * n, cycles);
+}
+
+libsee_export void cblas_daxpy(int n, double alpha, double const *x, int incx, double *y, int incy) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, cblas_daxpy, n, alpha, x, incx, y, incy);
+    libsee_blas_leave(start, "daxpy", n, 1, 1, 2ull * n, cycles);
+}
+
+libsee_export float cblas_sdot(int n, float const *x, int incx, float const *y, int incy) {
+    long long start = libsee_blas_enter();
+    float result;
+    size_t cycles;
+    libsee_module_assign_cycles(result, cycles, cblas_sdot, n, x, incx, y, incy);
+    libsee_blas_leave(start, "sdot", n, 1, 1, 2ull * n, cycles);
+    return result;
+}
+
+libsee_export double cblas_ddot(int n, double const *x, int incx, double const *y, int incy) {
+    long long start = libsee_blas_enter();
+    double result;
+    size_t cycles;
+    libsee_module_assign_cycles(result, cycles, cblas_ddot, n, x, incx, y, incy);
+    libsee_blas_leave(start, "ddot", n, 1, 1, 2ull * n, cycles);
+    return result;
+}
+
+libsee_export void sgemm_(char const *transpose_a, char const *transpose_b, int const *m, int const *n, int const *k,
+    float const *alpha, float const *a, int const *lda, float const *b, int const *ldb, float const *beta, float *c,
+    int const *ldc) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(
+        cycles, sgemm_, transpose_a, transpose_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    libsee_blas_leave(start, "sgemm", *m, *n, *k, 2ull * *m * *n * *k, cycles);
+}
+
+libsee_export void dgemm_(char const *transpose_a, char const *transpose_b, int const *m, int const *n, int const *k,
+    double const *alpha, double const *a, int const *lda, double const *b, int const *ldb, double const *beta,
+    double *c, int const *ldc) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(
+        cycles, dgemm_, transpose_a, transpose_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    libsee_blas_leave(start, "dgemm", *m, *n, *k, 2ull * *m * *n * *k, cycles);
+}
+
+libsee_export void sgemv_(char const *transpose, int const *m, int const *n, float const *alpha, float const *a,
+    int const *lda, float const *x, int const *incx, float const *beta, float *y, int const *incy) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, sgemv_, transpose, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    libsee_blas_leave(start, "sgemv", *m, *n, 1, 2ull * *m * *n, cycles);
+}
+
+libsee_export void dgemv_(char const *transpose, int const *m, int const *n, double const *alpha, double const *a,
+    int const *lda, double const *x, int const *incx, double const *beta, double *y, int const *incy) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, dgemv_, transpose, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    libsee_blas_leave(start, "dgemv", *m, *n, 1, 2ull * *m * *n, cycles);
+}
+
+libsee_export void saxpy_(int const *n, float const *alpha, float const *x, int const *incx, float *y,
+    int const *incy) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, saxpy_, n, alpha, x, incx, y, incy);
+    libsee_blas_leave(start, "saxpy", *n, 1, 1, 2ull * *n, cycles);
+}
+
+libsee_export void daxpy_(int const *n, double const *alpha, double const *x, int const *incx, double *y,
+    int const *incy) {
+    long long start = libsee_blas_enter();
+    size_t cycles;
+    libsee_module_noreturn_cycles(cycles, daxpy_, n, alpha, x, incx, y, incy);
+    libsee_blas_leave(start, "daxpy", *n, 1, 1, 2ull * *n, cycles);
+}
+
+libsee_export float sdot_(int const *n, float const *x, int const *incx, float const *y, int const *incy) {
+    long long start = libsee_blas_enter();
+    float result;
+    size_t cycles;
+    libsee_module_assign_cycles(result, cycles, sdot_, n, x, incx, y, incy);
+    libsee_blas_leave(start, "sdot", *n, 1, 1, 2ull * *n, cycles);
+    return result;
+}
+
+libsee_export double ddot_(int const *n, double const *x, int const *incx, double const *y, int const *incy) {
+    long long start = libsee_blas_enter();
+    double result;
+    size_t cycles;
+    libsee_module_assign_cycles(result, cycles, ddot_, n, x, incx, y, incy);
+    libsee_blas_leave(start, "ddot", *n, 1, 1, 2ull * *n, cycles);
+    return result;
+}
+
+/** LAPACK drivers, only in the Fortran interface
+ *  https://www.netlib.org/lapack/explore-html/
+ *
+ *  The factorizations share the shape classes with BLAS, using the operation counts from the LAPACK
+ *  Working Note 41. The eigenvalue and singular value decompositions are iterative and are only timed.
+ *  Passing `lwork = -1` only queries the optimal workspace size, which is cheap, but the same query is
+ *  often repeated in solver loops for identical shapes, so such calls are tracked in a separate table.
+ *  Fortran appends the lengths of the CHARACTER arguments as hidden `size_t` arguments, forwarded unchanged.
+ */
+typedef struct libsee_workspace_query {
+    size_t key;          // Hash of the routine, the dimensions, and the job, or zero for free slots
+    char const *routine; // Like "dgeqrf"
+    long long rows, columns;
+    char job; // The `jobz` argument of the decompositions, or zero
+    size_t calls;
+} libsee_workspace_query;
+
+static libsee_workspace_query libsee_workspace_queries[LIBSEE_MAX_BLAS_SHAPES] = {0};
+
+int libsee_workspace_query_matches(void const *slot, void const *identity) {
+    libsee_workspace_query const *stored = (libsee_workspace_query const *)slot;
+    libsee_workspace_query const *query = (libsee_workspace_query const *)identity;
+    return libsee_names_equal(stored->routine, query->routine) && stored->rows == query->rows &&
+           stored->columns == query->columns && stored->job == query->job;
+}
+
+void libsee_workspace_query_fill(void *slot, void const *identity) {
+    libsee_workspace_query *stored = (libsee_workspace_query *)slot;
+    libsee_workspace_query const *query = (libsee_workspace_query const *)identity;
+    stored->routine = query->routine, stored->rows = query->rows, stored->columns = query->columns;
+    stored->job = query->job;
+}
+
+void libsee_lapack_query(char const *routine, long long rows, long long columns, char job) {
+    if (libsee_module_depth) return;
+    unsigned long long hash = 0xCBF29CE484222325ull; // FNV-1a
+    for (char const *it = routine; *it; ++it) hash = (hash ^ (unsigned char)*it) * 0x100000001B3ull;
+    hash = (hash ^ (unsigned long long)rows) * 0x100000001B3ull;
+    hash = (hash ^ (unsigned long long)columns) * 0x100000001B3ull;
+    hash = (hash ^ (unsigned char)job) * 0x100000001B3ull;
+    libsee_workspace_query identity = {0, routine, rows, columns, job, 0};
+    libsee_workspace_query *slot = (libsee_workspace_query *)libsee_shared_slot(libsee_workspace_queries,
+        sizeof(libsee_workspace_query), LIBSEE_MAX_BLAS_SHAPES, (size_t)hash, &identity,
+        libsee_workspace_query_matches, libsee_workspace_query_fill);
+    if (slot) __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+}
+
+/*
+ *  Operation counts of the LU and QR factorizations of an M by N matrix, and the Cholesky one of N by N.
+ */
+static inline size_t libsee_getrf_flops(long long m, long long n) {
+    double p = (double)(m < n ? m : n), q = (double)(m < n ? n : m);
+    return (size_t)(q * p * p - p * p * p / 3);
+}
+static inline size_t libsee_geqrf_flops(long long m, long long n) {
+    double p = (double)(m < n ? m : n), q = (double)(m < n ? n : m);
+    return (size_t)(2 * q * p * p - 2 * p * p * p / 3);
+}
+static inline size_t libsee_potrf_flops(long long n) { return (size_t)((double)n * n * n / 3); }
+
+/*
+ *  Every driver has the same structure, differing in the arguments, the shape, and the operation count.
+ */
+#define libsee_lapack_factorization(function_name, routine, rows, columns, depth, flops, ...) \
+    do {                                                                                      \
+        long long _start = libsee_blas_enter();                                               \
+        size_t _cycles;                                                                       \
+        libsee_module_noreturn_cycles(_cycles, function_name, __VA_ARGS__);                   \
+        libsee_blas_leave(_start, routine, rows, columns, depth, flops, _cycles);             \
+    } while (0)
+
+#define libsee_lapack_querying(function_name, routine, rows, columns, job, lwork, flops, ...) \
+    do {                                                                                      \
+        long long _start = libsee_blas_enter();                                               \
+        size_t _cycles;                                                                       \
+        libsee_module_noreturn_cycles(_cycles, function_name, __VA_ARGS__);                   \
+        if (*lwork == -1) libsee_lapack_query(routine, rows, columns, job);                   \
+        else libsee_blas_leave(_start, routine, rows, columns, 1, flops, _cycles);            \
+    } while (0)
+
+libsee_export void sgesv_(int const *n, int const *nrhs, float *a, int const *lda, int *pivots, float *b,
+    int const *ldb, int *info) {
+    libsee_lapack_factorization(sgesv_, "sgesv", *n, *n, *nrhs,
+        libsee_getrf_flops(*n, *n) + 2ull * *n * *n * *nrhs, n, nrhs, a, lda, pivots, b, ldb, info);
+}
+
+libsee_export void dgesv_(int const *n, int const *nrhs, double *a, int const *lda, int *pivots, double *b,
+    int const *ldb, int *info) {
+    libsee_lapack_factorization(dgesv_, "dgesv", *n, *n, *nrhs,
+        libsee_getrf_flops(*n, *n) + 2ull * *n * *n * *nrhs, n, nrhs, a, lda, pivots, b, ldb, info);
+}
+
+libsee_export void sgetrf_(int const *m, int const *n, float *a, int const *lda, int *pivots, int *info) {
+    libsee_lapack_factorization(sgetrf_, "sgetrf", *m, *n, 1, libsee_getrf_flops(*m, *n), m, n, a, lda, pivots, info);
+}
+
+libsee_export void dgetrf_(int const *m, int const *n, double *a, int const *lda, int *pivots, int *info) {
+    libsee_lapack_factorization(dgetrf_, "dgetrf", *m, *n, 1, libsee_getrf_flops(*m, *n), m, n, a, lda, pivots, info);
+}
+
+libsee_export void spotrf_(char const *uplo, int const *n, float *a, int const *lda, int *info, size_t uplo_length) {
+    libsee_lapack_factorization(spotrf_, "spotrf", *n, *n, 1, libsee_potrf_flops(*n), uplo, n, a, lda, info,
+        uplo_length);
+}
+
+libsee_export void dpotrf_(char const *uplo, int const *n, double *a, int const *lda, int *info, size_t uplo_length) {
+    libsee_lapack_factorization(dpotrf_, "dpotrf", *n, *n, 1, libsee_potrf_flops(*n), uplo, n, a, lda, info,
+        uplo_length);
+}
+
+libsee_export void sgeqrf_(int const *m, int const *n, float *a, int const *lda, float *tau, float *work,
+    int const *lwork, int *info) {
+    libsee_lapack_querying(sgeqrf_, "sgeqrf", *m, *n, 0, lwork, libsee_geqrf_flops(*m, *n), m, n, a, lda, tau, work,
+        lwork, info);
+}
+
+libsee_export void dgeqrf_(int const *m, int const *n, double *a, int const *lda, double *tau, double *work,
+    int const *lwork, int *info) {
+    libsee_lapack_querying(dgeqrf_, "dgeqrf", *m, *n, 0, lwork, libsee_geqrf_flops(*m, *n), m, n, a, lda, tau, work,
+        lwork, info);
+}
+
+libsee_export void ssyev_(char const *jobz, char const *uplo, int const *n, float *a, int const *lda, float *w,
+    float *work, int const *lwork, int *info, size_t jobz_length, size_t uplo_length) {
+    libsee_lapack_querying(ssyev_, "ssyev", *n, *n, *jobz, lwork, 0, jobz, uplo, n, a, lda, w, work, lwork, info,
+        jobz_length, uplo_length);
+}
+
+libsee_export void dsyev_(char const *jobz, char const *uplo, int const *n, double *a, int const *lda, double *w,
+    double *work, int const *lwork, int *info, size_t jobz_length, size_t uplo_length) {
+    libsee_lapack_querying(dsyev_, "dsyev", *n, *n, *jobz, lwork, 0, jobz, uplo, n, a, lda, w, work, lwork, info,
+        jobz_length, uplo_length);
+}
+
+libsee_export void sgesdd_(char const *jobz, int const *m, int const *n, float *a, int const *lda, float *s, float *u,
+    int const *ldu, float *vt, int const *ldvt, float *work, int const *lwork, int *iwork, int *info,
+    size_t jobz_length) {
+    libsee_lapack_querying(sgesdd_, "sgesdd", *m, *n, *jobz, lwork, 0, jobz, m, n, a, lda, s, u, ldu, vt, ldvt, work,
+        lwork, iwork, info, jobz_length);
+}
+
+libsee_export void dgesdd_(char const *jobz, int const *m, int const *n, double *a, int const *lda, double *s,
+    double *u, int const *ldu, double *vt, int const *ldvt, double *work, int const *lwork, int *iwork, int *info,
+    size_t jobz_length) {
+    libsee_lapack_querying(dgesdd_, "dgesdd", *m, *n, *jobz, lwork, 0, jobz, m, n, a, lda, s, u, ldu, vt, ldvt, work,
+        lwork, iwork, info, jobz_length);
+}
+
+#endif // LIBSEE_BLAS
+
+#if LIBSEE_ZLIB
+
+/** zlib, the streaming and the one-shot interfaces, and the checksums
+ *  https://www.zlib.net/manual.html
+ *
+ *  Every call is attributed to its call site, accumulating the uncompressed and the compressed bytes,
+ *  from the deltas of `total_in` and `total_out` for the streams, to estimate the ratio and the throughput.
+ *  The one-shot `compress2` and `uncompress` create and destroy a stream on every call, and so do the
+ *  applications calling `deflateInit` and `deflateEnd` per message, while the state of a deflate stream
+ *  takes hundreds of kilobytes to allocate and initialize. Both count as streams, compared to the resets.
+ *  The nested calls, like the `deflate` inside of `compress2`, are not attributed to the call sites.
+ */
+typedef struct libsee_zlib_site {
+    size_t key;                // Hash of the function and the return address, or zero for free slots
+    char const *function_name; // Like "deflate"
+    size_t origin;             // Return address in the application code
+    size_t calls;
+    size_t uncompressed_bytes;
+    size_t compressed_bytes;
+    size_t cycles;
+    size_t nanoseconds;
+} libsee_zlib_site;
+
+typedef struct libsee_zlib_stats {
+    size_t deflate_streams, inflate_streams;
+    size_t deflate_resets, inflate_resets;
+    size_t deflated_bytes, inflated_bytes; // Uncompressed sizes, to estimate the lifetime of a stream
+} libsee_zlib_stats;
+
+static libsee_zlib_site libsee_zlib_sites[LIBSEE_MAX_ZLIB_SITES] = {0};
+static libsee_zlib_stats libsee_zlib = {0};
+
+int libsee_zlib_site_matches(void const *slot, void const *identity) {
+    libsee_zlib_site const *site = (libsee_zlib_site const *)slot;
+    libsee_keyed_identity const *keyed = (libsee_keyed_identity const *)identity;
+    return site->origin == keyed->origin && site->function_name == keyed->function_name;
+}
+
+void libsee_zlib_site_fill(void *slot, void const *identity) {
+    libsee_zlib_site *site = (libsee_zlib_site *)slot;
+    libsee_keyed_identity const *keyed = (libsee_keyed_identity const *)identity;
+    site->function_name = keyed->function_name, site->origin = keyed->origin;
+}
+
+long long libsee_zlib_enter(void) {
+    libsee_initialize_if_not();
+    return libsee_clock_nanoseconds(CLOCK_MONOTONIC);
+}
+
+/**
+ *  @brief  Attributes the outermost zlib call to its call site.
+ *  @return Zero for the nested calls, which were not recorded.
+ */
+int libsee_zlib_leave(long long start, char const *function_name, size_t origin, size_t uncompressed_bytes,
+    size_t compressed_bytes, size_t cycles) {
+    long long nanoseconds = libsee_clock_nanoseconds(CLOCK_MONOTONIC) - start;
+    if (libsee_module_depth) return 0;
+    unsigned long long hash = (unsigned long long)origin * 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ (hash >> 32) ^ (unsigned long long)(size_t)function_name) * 0xBF58476D1CE4E5B9ull;
+    libsee_keyed_identity identity = {function_name, origin};
+    libsee_zlib_site *slot = (libsee_zlib_site *)libsee_shared_slot(libsee_zlib_sites, sizeof(libsee_zlib_site),
+        LIBSEE_MAX_ZLIB_SITES, (size_t)(hash ^ (hash >> 29)), &identity, libsee_zlib_site_matches,
+        libsee_zlib_site_fill);
+    if (!slot) return 1;
+    __atomic_fetch_add(&slot->calls, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->uncompressed_bytes, uncompressed_bytes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->compressed_bytes, compressed_bytes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->cycles, cycles, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&slot->nanoseconds, nanoseconds > 0 ? (size_t)nanoseconds : 0, __ATOMIC_RELAXED);
+    return 1;
+}
+
+/*
+ *  Must be expanded directly inside of the exported wrapper, so that the return address points to the
+ *  application code calling zlib. The byte counts are only evaluated after the call returns.
+ */
+#define libsee_zlib_call(returned_value, function_name, uncompressed_bytes, compressed_bytes, ...)         \
+    do {                                                                                                   \
+        long long _start = libsee_zlib_enter();                                                            \
+        size_t _cycles;                                                                                    \
+        libsee_module_assign_cycles(returned_value, _cycles, function_name, __VA_ARGS__);                  \
+        libsee_zlib_leave(_start, #function_name, (size_t)__builtin_return_address(0), uncompressed_bytes, \
+            compressed_bytes, _cycles);                                                                    \
+    } while (0)
+
+/*
+ *  Streams are counted on initialization and compared against the resets, both only in the outermost calls,
+ *  as zlib itself resets the streams it initializes.
+ */
+#define libsee_zlib_counted(returned_value, function_name, counter, ...)                                   \
+    do {                                                                                                   \
+        long long _start = libsee_zlib_enter();                                                            \
+        size_t _cycles;                                                                                    \
+        libsee_module_assign_cycles(returned_value, _cycles, function_name, __VA_ARGS__);                  \
+        if (libsee_zlib_leave(_start, #function_name, (size_t)__builtin_return_address(0), 0, 0, _cycles)) \
+            __atomic_fetch_add(&libsee_zlib.counter, 1, __ATOMIC_RELAXED);                                 \
+    } while (0)
+
+libsee_export int deflateInit_(struct z_stream_s *stream, int level, char const *version, int stream_size) {
+    int result;
+    libsee_zlib_counted(result, deflateInit_, deflate_streams, stream, level, version, stream_size);
+    return result;
+}
+
+libsee_export int deflateInit2_(struct z_stream_s *stream, int level, int method, int window_bits, int memory_level,
+    int strategy, char const *version, int stream_size) {
+    int result;
+    libsee_zlib_counted(result, deflateInit2_, deflate_streams, stream, level, method, window_bits, memory_level,
+        strategy, version, stream_size);
+    return result;
+}
+
+libsee_export int deflate(struct z_stream_s *stream, int flush) {
+    unsigned long total_in = stream ? stream->total_in : 0, total_out = stream ? stream->total_out : 0;
+    int result;
+    libsee_zlib_call(result, deflate, stream ? stream->total_in - total_in : 0,
+        stream ? stream->total_out - total_out : 0, stream, flush);
+    if (stream && !libsee_module_depth)
+        __atomic_fetch_add(&libsee_zlib.deflated_bytes, stream->total_in - total_in, __ATOMIC_RELAXED);
+    return result;
+}
+
+libsee_export int deflateReset(struct z_stream_s *stream) {
+    int result;
+    libsee_zlib_counted(result, deflateReset, deflate_resets, stream);
+    return result;
+}
+
+libsee_export int deflateEnd(struct z_stream_s *stream) {
+    int result;
+    libsee_zlib_call(result, deflateEnd, 0, 0, stream);
+    return result;
+}
+
+libsee_export int inflateInit_(struct z_stream_s *stream, char const *version, int stream_size) {
+    int result;
+    libsee_zlib_counted(result, inflateInit_, inflate_streams, stream, version, stream_size);
+    return result;
+}
+
+libsee_export int inflateInit2_(struct z_stream_s *stream, int window_bits, char const *version, int stream_size) {
+    int result;
+    libsee_zlib_counted(result, inflateInit2_, inflate_streams, stream, window_bits, version, stream_size);
+    return result;
+}
+
+libsee_export int inflate(struct z_stream_s *stream, int flush) {
+    unsigned long total_in = stream ? stream->total_in : 0, total_out = stream ? stream->total_out : 0;
+    int result;
+    libsee_zlib_call(result, inflate, stream ? stream->total_out - total_out : 0,
+        stream ? stream->total_in - total_in : 0, stream, flush);
+    if (stream && !libsee_module_depth)
+        __atomic_fetch_add(&libsee_zlib.inflated_bytes, stream->total_out - total_out, __ATOMIC_RELAXED);
+    return result;
+}
+
+libsee_export int inflateReset(struct z_stream_s *stream) {
+    int result;
+    libsee_zlib_counted(result, inflateReset, inflate_resets, stream);
+    return result;
+}
+
+libsee_export int inflateEnd(struct z_stream_s *stream) {
+    int result;
+    libsee_zlib_call(result, inflateEnd, 0, 0, stream);
+    return result;
+}
+
+libsee_export int compress2(unsigned char *destination, unsigned long *destination_length,
+    unsigned char const *source, unsigned long source_length, int level) {
+    int result;
+    libsee_zlib_call(result, compress2, result == Z_OK ? source_length : 0, result == Z_OK ? *destination_length : 0,
+        destination, destination_length, source, source_length, level);
+    if (result == Z_OK && !libsee_module_depth) {
+        __atomic_fetch_add(&libsee_zlib.deflate_streams, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&libsee_zlib.deflated_bytes, source_length, __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+libsee_export int uncompress(unsigned char *destination, unsigned long *destination_length,
+    unsigned char const *source, unsigned long source_length) {
+    int result;
+    libsee_zlib_call(result, uncompress, result == Z_OK ? *destination_length : 0, result == Z_OK ? source_length : 0,
+        destination, destination_length, source, source_length);
+    if (result == Z_OK && !libsee_module_depth) {
+        __atomic_fetch_add(&libsee_zlib.inflate_streams, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&libsee_zlib.inflated_bytes, *destination_length, __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+libsee_export unsigned long crc32(unsigned long crc, unsigned char const *buffer, unsigned int length) {
+    unsigned long result;
+    libsee_zlib_call(result, crc32, buffer ? length : 0, 0, crc, buffer, length);
+    return result;
+}
+
+libsee_export unsigned long adler32(unsigned long adler, unsigned char const *buffer, unsigned int length) {
+    unsigned long result;
+    libsee_zlib_call(result, adler32, buffer ? length : 0, 0, adler, buffer, length);
+    return result;
+}
+
+#endif // LIBSEE_ZLIB
+
+#pragma endregion
+
+#pragma region Shared Implementation Components
+
+typedef struct libsee_name_stats {
+    char const *function_name;
+    size_t total_cycles;
+    size_t total_calls;
+    size_t total_bytes;
+} libsee_name_stats;
+
+void libsee_initialize(void) {
+
+    // Initialize all the cycles to zeros, without using `memset`
+    size_t *cycles = libsee_thread_cycles[0].indexed;
+    size_t *calls = libsee_thread_calls[0].indexed;
+    size_t *bytes = libsee_thread_bytes[0].indexed;
+    size_t total_counters_per_thread = sizeof(thread_local_counters) / sizeof(size_t);
+    size_t total_counters_across_threads = LIBSEE_MAX_THREADS * total_counters_per_thread;
+    for (size_t i = 0; i < total_counters_across_threads; i++) cycles[i] = calls[i] = bytes[i] = 0;
+
+    // Load the symbols from the underlying implementation
+    real_apis *apis = &libsee_apis;
+
+    apis->strcpy = (api_strcpy_t)dlsym(RTLD_NEXT, "strcpy");
+    apis->strncpy = (api_strncpy_t)dlsym(RTLD_NEXT, "strncpy");
+    apis->strcat = (api_strcat_t)dlsym(RTLD_NEXT, "strcat");
+    apis->strncat = (api_strncat_t)dlsym(RTLD_NEXT, "strncat");
+    apis->strxfrm = (api_strxfrm_t)dlsym(RTLD_NEXT, "strxfrm");
+    apis->strlen = (api_strlen_t)dlsym(RTLD_NEXT, "strlen");
+    apis->strcmp = (api_strcmp_t)dlsym(RTLD_NEXT, "strcmp");
+    apis->strncmp = (api_strncmp_t)dlsym(RTLD_NEXT, "strncmp");
+    apis->strcoll = (api_strcoll_t)dlsym(RTLD_NEXT, "strcoll");
+    apis->strchr = (api_strchr_t)dlsym(RTLD_NEXT, "strchr");
+    apis->strrchr = (api_strrchr_t)dlsym(RTLD_NEXT, "strrchr");
+    apis->strspn = (api_strspn_t)dlsym(RTLD_NEXT, "strspn");
+    apis->strcspn = (api_strcspn_t)dlsym(RTLD_NEXT, "strcspn");
+    apis->strpbrk = (api_strpbrk_t)dlsym(RTLD_NEXT, "strpbrk");
+    apis->strstr = (api_strstr_t)dlsym(RTLD_NEXT, "strstr");
+    apis->strtok = (api_strtok_t)dlsym(RTLD_NEXT, "strtok");
+    apis->memchr = (api_memchr_t)dlsym(RTLD_NEXT, "memchr");
+    apis->memcmp = (api_memcmp_t)dlsym(RTLD_NEXT, "memcmp");
+    apis->memset = (api_memset_t)dlsym(RTLD_NEXT, "memset");
+    apis->memcpy = (api_memcpy_t)dlsym(RTLD_NEXT, "memcpy");
+    apis->memmove = (api_memmove_t)dlsym(RTLD_NEXT, "memmove");
+    apis->strerror = (api_strerror_t)dlsym(RTLD_NEXT, "strerror");
+    apis->memmem = (api_memmem_t)dlsym(RTLD_NEXT, "memmem");
+    apis->memrchr = (api_memrchr_t)dlsym(RTLD_NEXT, "memrchr");
+
+    apis->wcstombs = (api_wcstombs_t)dlsym(RTLD_NEXT, "wcstombs");
+    apis->wcswidth = (api_wcswidth_t)dlsym(RTLD_NEXT, "wcswidth");
+    apis->wcwidth = (api_wcwidth_t)dlsym(RTLD_NEXT, "wcwidth");
+
+    apis->wcslen = (api_wcslen_t)dlsym(RTLD_NEXT, "wcslen");
+    apis->wcsnlen = (api_wcsnlen_t)dlsym(RTLD_NEXT, "wcsnlen");
+    apis->wcscmp = (api_wcscmp_t)dlsym(RTLD_NEXT, "wcscmp");
+    apis->wcsncmp = (api_wcsncmp_t)dlsym(RTLD_NEXT, "wcsncmp");
+    apis->wcscpy = (api_wcscpy_t)dlsym(RTLD_NEXT, "wcscpy");
+    apis->wcsncpy = (api_wcsncpy_t)dlsym(RTLD_NEXT, "wcsncpy");
+    apis->wcscat = (api_wcscat_t)dlsym(RTLD_NEXT, "wcscat");
+    apis->wcschr = (api_wcschr_t)dlsym(RTLD_NEXT, "wcschr");
+    apis->wcsrchr = (api_wcsrchr_t)dlsym(RTLD_NEXT, "wcsrchr");
+    apis->wcsstr = (api_wcsstr_t)dlsym(RTLD_NEXT, "wcsstr");
+    apis->wcstok = (api_wcstok_t)dlsym(RTLD_NEXT, "wcstok");
+    apis->wmemcpy = (api_wmemcpy_t)dlsym(RTLD_NEXT, "wmemcpy");
+    apis->wmemmove = (api_wmemmove_t)dlsym(RTLD_NEXT, "wmemmove");
+    apis->wmemset = (api_wmemset_t)dlsym(RTLD_NEXT, "wmemset");
+    apis->wmemcmp = (api_wmemcmp_t)dlsym(RTLD_NEXT, "wmemcmp");
+    apis->wmemchr = (api_wmemchr_t)dlsym(RTLD_NEXT, "wmemchr");
+    apis->wcscoll = (api_wcscoll_t)dlsym(RTLD_NEXT, "wcscoll");
+    apis->wcsxfrm = (api_wcsxfrm_t)dlsym(RTLD_NEXT, "wcsxfrm");
+
+    apis->mbrtowc = (api_mbrtowc_t)dlsym(RTLD_NEXT, "mbrtowc");
+    apis->mbstowcs = (api_mbstowcs_t)dlsym(RTLD_NEXT, "mbstowcs");
+    apis->wcrtomb = (api_wcrtomb_t)dlsym(RTLD_NEXT, "wcrtomb");
+    apis->wcsrtombs = (api_wcsrtombs_t)dlsym(RTLD_NEXT, "wcsrtombs");
+    apis->mbrlen = (api_mbrlen_t)dlsym(RTLD_NEXT, "mbrlen");
+    apis->mbsrtowcs = (api_mbsrtowcs_t)dlsym(RTLD_NEXT, "mbsrtowcs");
+    apis->btowc = (api_btowc_t)dlsym(RTLD_NEXT, "btowc");
+    apis->iconv = (api_iconv_t)dlsym(RTLD_NEXT, "iconv");
+
+    apis->malloc = (api_malloc_t)dlsym(RTLD_NEXT, "malloc");
+    apis->calloc = (api_calloc_t)dlsym(RTLD_NEXT, "calloc");
+    apis->realloc = (api_realloc_t)dlsym(RTLD_NEXT, "realloc");
+    apis->free = (api_free_t)dlsym(RTLD_NEXT, "free");
+    apis->aligned_alloc = (api_aligned_alloc_t)dlsym(RTLD_NEXT, "aligned_alloc");
+
+    apis->qsort = (api_qsort_t)dlsym(RTLD_NEXT, "qsort");
+    apis->bsearch = (api_bsearch_t)dlsym(RTLD_NEXT, "bsearch");
+
+    apis->srand = (api_srand_t)dlsym(RTLD_NEXT, "srand");
+    apis->rand = (api_rand_t)dlsym(RTLD_NEXT, "rand");
+
+    apis->random = (api_random_t)dlsym(RTLD_NEXT, "random");
+    apis->srandom = (api_srandom_t)dlsym(RTLD_NEXT, "srandom");
+    apis->rand_r = (api_rand_r_t)dlsym(RTLD_NEXT, "rand_r");
+    apis->random_r = (api_random_r_t)dlsym(RTLD_NEXT, "random_r");
+    apis->drand48 = (api_drand48_t)dlsym(RTLD_NEXT, "drand48");
+    apis->erand48 = (api_erand48_t)dlsym(RTLD_NEXT, "erand48");
+    apis->lrand48 = (api_lrand48_t)dlsym(RTLD_NEXT, "lrand48");
+    apis->nrand48 = (api_nrand48_t)dlsym(RTLD_NEXT, "nrand48");
+    apis->mrand48 = (api_mrand48_t)dlsym(RTLD_NEXT, "mrand48");
+    apis->jrand48 = (api_jrand48_t)dlsym(RTLD_NEXT, "jrand48");
+    apis->srand48 = (api_srand48_t)dlsym(RTLD_NEXT, "srand48");
+    apis->seed48 = (api_seed48_t)dlsym(RTLD_NEXT, "seed48");
+    apis->lcong48 = (api_lcong48_t)dlsym(RTLD_NEXT, "lcong48");
+    apis->arc4random = (api_arc4random_t)dlsym(RTLD_NEXT, "arc4random");
+    apis->arc4random_buf = (api_arc4random_buf_t)dlsym(RTLD_NEXT, "arc4random_buf");
+    apis->arc4random_uniform = (api_arc4random_uniform_t)dlsym(RTLD_NEXT, "arc4random_uniform");
+    apis->getrandom = (api_getrandom_t)dlsym(RTLD_NEXT, "getrandom");
+    // LibM may only be loaded later, so its symbols are resolved on the first call with `libsee_resolve_lazily`
+
+    apis->strtol = (api_strtol_t)dlsym(RTLD_NEXT, "strtol");
+    apis->strtoll = (api_strtoll_t)dlsym(RTLD_NEXT, "strtoll");
+    apis->strtoul = (api_strtoul_t)dlsym(RTLD_NEXT, "strtoul");
+    apis->strtoull = (api_strtoull_t)dlsym(RTLD_NEXT, "strtoull");
+    apis->strtoimax = (api_strtoimax_t)dlsym(RTLD_NEXT, "strtoimax");
+    apis->strtoumax = (api_strtoumax_t)dlsym(RTLD_NEXT, "strtoumax");
+    apis->strtof = (api_strtof_t)dlsym(RTLD_NEXT, "strtof");
+    apis->strtod = (api_strtod_t)dlsym(RTLD_NEXT, "strtod");
+    apis->strtold = (api_strtold_t)dlsym(RTLD_NEXT, "strtold");
+    apis->strtol_l = (api_strtol_l_t)dlsym(RTLD_NEXT, "strtol_l");
+    apis->strtoll_l = (api_strtoll_l_t)dlsym(RTLD_NEXT, "strtoll_l");
+    apis->strtoul_l = (api_strtoul_l_t)dlsym(RTLD_NEXT, "strtoul_l");
+    apis->strtoull_l = (api_strtoull_l_t)dlsym(RTLD_NEXT, "strtoull_l");
+    apis->strtof_l = (api_strtof_l_t)dlsym(RTLD_NEXT, "strtof_l");
+    apis->strtod_l = (api_strtod_l_t)dlsym(RTLD_NEXT, "strtod_l");
+    apis->strtold_l = (api_strtold_l_t)dlsym(RTLD_NEXT, "strtold_l");
+    apis->atoi = (api_atoi_t)dlsym(RTLD_NEXT, "atoi");
+    apis->atol = (api_atol_t)dlsym(RTLD_NEXT, "atol");
+    apis->atoll = (api_atoll_t)dlsym(RTLD_NEXT, "atoll");
+    apis->atof = (api_atof_t)dlsym(RTLD_NEXT, "atof");
+    apis->strfromf = (api_strfromf_t)dlsym(RTLD_NEXT, "strfromf");
+    apis->strfromd = (api_strfromd_t)dlsym(RTLD_NEXT, "strfromd");
+    apis->strfroml = (api_strfroml_t)dlsym(RTLD_NEXT, "strfroml");
+
+    apis->setlocale = (api_setlocale_t)dlsym(RTLD_NEXT, "setlocale");
+    apis->localeconv = (api_localeconv_t)dlsym(RTLD_NEXT, "localeconv");
+    apis->newlocale = (api_newlocale_t)dlsym(RTLD_NEXT, "newlocale");
+    apis->uselocale = (api_uselocale_t)dlsym(RTLD_NEXT, "uselocale");
+    apis->duplocale = (api_duplocale_t)dlsym(RTLD_NEXT, "duplocale");
+    apis->freelocale = (api_freelocale_t)dlsym(RTLD_NEXT, "freelocale");
+    apis->nl_langinfo = (api_nl_langinfo_t)dlsym(RTLD_NEXT, "nl_langinfo");
+
+    apis->fopen = (api_fopen_t)dlsym(RTLD_NEXT, "fopen");
+    apis->freopen = (api_freopen_t)dlsym(RTLD_NEXT, "freopen");
+    apis->fclose = (api_fclose_t)dlsym(RTLD_NEXT, "fclose");
+    apis->fflush = (api_fflush_t)dlsym(RTLD_NEXT, "fflush");
+    apis->setbuf = (api_setbuf_t)dlsym(RTLD_NEXT, "setbuf");
+    apis->setvbuf = (api_setvbuf_t)dlsym(RTLD_NEXT, "setvbuf");
+    apis->fread = (api_fread_t)dlsym(RTLD_NEXT, "fread");
+    apis->fwrite = (api_fwrite_t)dlsym(RTLD_NEXT, "fwrite");
+    apis->fseek = (api_fseek_t)dlsym(RTLD_NEXT, "fseek");
+    apis->ftell = (api_ftell_t)dlsym(RTLD_NEXT, "ftell");
+    apis->fsetpos = (api_fsetpos_t)dlsym(RTLD_NEXT, "fsetpos");
+    apis->fgetpos = (api_fgetpos_t)dlsym(RTLD_NEXT, "fgetpos");
+    apis->rewind = (api_rewind_t)dlsym(RTLD_NEXT, "rewind");
+    apis->clearerr = (api_clearerr_t)dlsym(RTLD_NEXT, "clearerr");
+    apis->feof = (api_feof_t)dlsym(RTLD_NEXT, "feof");
+    apis->ferror = (api_ferror_t)dlsym(RTLD_NEXT, "ferror");
+    apis->perror = (api_perror_t)dlsym(RTLD_NEXT, "perror");
+
+    apis->fgetc = (api_fgetc_t)dlsym(RTLD_NEXT, "fgetc");
+    apis->getc = (api_getc_t)dlsym(RTLD_NEXT, "getc");
+    apis->getchar = (api_getchar_t)dlsym(RTLD_NEXT, "getchar");
+    apis->fgets = (api_fgets_t)dlsym(RTLD_NEXT, "fgets");
+    apis->ungetc = (api_ungetc_t)dlsym(RTLD_NEXT, "ungetc");
+    apis->getline = (api_getline_t)dlsym(RTLD_NEXT, "getline");
+    apis->getdelim = (api_getdelim_t)dlsym(RTLD_NEXT, "getdelim");
+    apis->fputc = (api_fputc_t)dlsym(RTLD_NEXT, "fputc");
+    apis->putc = (api_putc_t)dlsym(RTLD_NEXT, "putc");
+    apis->putchar = (api_putchar_t)dlsym(RTLD_NEXT, "putchar");
+    apis->fputs = (api_fputs_t)dlsym(RTLD_NEXT, "fputs");
+    apis->puts = (api_puts_t)dlsym(RTLD_NEXT, "puts");
+    apis->fgetc_unlocked = (api_fgetc_unlocked_t)dlsym(RTLD_NEXT, "fgetc_unlocked");
+    apis->getc_unlocked = (api_getc_unlocked_t)dlsym(RTLD_NEXT, "getc_unlocked");
+    apis->getchar_unlocked = (api_getchar_unlocked_t)dlsym(RTLD_NEXT, "getchar_unlocked");
+    apis->fgets_unlocked = (api_fgets_unlocked_t)dlsym(RTLD_NEXT, "fgets_unlocked");
+    apis->fputc_unlocked = (api_fputc_unlocked_t)dlsym(RTLD_NEXT, "fputc_unlocked");
+    apis->putc_unlocked = (api_putc_unlocked_t)dlsym(RTLD_NEXT, "putc_unlocked");
+    apis->putchar_unlocked = (api_putchar_unlocked_t)dlsym(RTLD_NEXT, "putchar_unlocked");
+    apis->fputs_unlocked = (api_fputs_unlocked_t)dlsym(RTLD_NEXT, "fputs_unlocked");
+    apis->scanf = (api_scanf_t)dlsym(RTLD_NEXT, "scanf");
+    apis->fscanf = (api_fscanf_t)dlsym(RTLD_NEXT, "fscanf");
+    apis->sscanf = (api_sscanf_t)dlsym(RTLD_NEXT, "sscanf");
+    apis->vscanf = (api_vscanf_t)dlsym(RTLD_NEXT, "vscanf");
+    apis->vfscanf = (api_vfscanf_t)dlsym(RTLD_NEXT, "vfscanf");
+    apis->vsscanf = (api_vsscanf_t)dlsym(RTLD_NEXT, "vsscanf");
+    apis->printf = (api_printf_t)dlsym(RTLD_NEXT, "printf");
+    apis->fprintf = (api_fprintf_t)dlsym(RTLD_NEXT, "fprintf");
+    apis->sprintf = (api_sprintf_t)dlsym(RTLD_NEXT, "sprintf");
+    apis->snprintf = (api_snprintf_t)dlsym(RTLD_NEXT, "snprintf");
+    apis->vprintf = (api_vprintf_t)dlsym(RTLD_NEXT, "vprintf");
+    apis->vfprintf = (api_vfprintf_t)dlsym(RTLD_NEXT, "vfprintf");
+    apis->vsprintf = (api_vsprintf_t)dlsym(RTLD_NEXT, "vsprintf");
+    apis->vsnprintf = (api_vsnprintf_t)dlsym(RTLD_NEXT, "vsnprintf");
+
+    apis->fgetwc = (api_fgetwc_t)dlsym(RTLD_NEXT, "fgetwc");
+    apis->getwc = (api_getwc_t)dlsym(RTLD_NEXT, "getwc");
+    apis->fgetws = (api_fgetws_t)dlsym(RTLD_NEXT, "fgetws");
+    apis->fputwc = (api_fputwc_t)dlsym(RTLD_NEXT, "fputwc");
+    apis->putwc = (api_putwc_t)dlsym(RTLD_NEXT, "putwc");
+    apis->fputws = (api_fputws_t)dlsym(RTLD_NEXT, "fputws");
+    apis->fwide = (api_fwide_t)dlsym(RTLD_NEXT, "fwide");
+    apis->vfwscanf = (api_vfwscanf_t)dlsym(RTLD_NEXT, "vfwscanf");
+    apis->vswscanf = (api_vswscanf_t)dlsym(RTLD_NEXT, "vswscanf");
+    apis->vwprintf = (api_vwprintf_t)dlsym(RTLD_NEXT, "vwprintf");
+    apis->vfwprintf = (api_vfwprintf_t)dlsym(RTLD_NEXT, "vfwprintf");
+    apis->vswprintf = (api_vswprintf_t)dlsym(RTLD_NEXT, "vswprintf");
+
+    apis->difftime = (api_difftime_t)dlsym(RTLD_NEXT, "difftime");
+    apis->time = (api_time_t)dlsym(RTLD_NEXT, "time");
+    apis->clock = (api_clock_t)dlsym(RTLD_NEXT, "clock");
+    apis->timespec_get = (api_timespec_get_t)dlsym(RTLD_NEXT, "timespec_get");
+    apis->timespec_getres = (api_timespec_getres_t)dlsym(RTLD_NEXT, "timespec_getres");
+    apis->asctime = (api_asctime_t)dlsym(RTLD_NEXT, "asctime");
+    apis->ctime = (api_ctime_t)dlsym(RTLD_NEXT, "ctime");
+    apis->strftime = (api_strftime_t)dlsym(RTLD_NEXT, "strftime");
+    apis->wcsftime = (api_wcsftime_t)dlsym(RTLD_NEXT, "wcsftime");
+    apis->gmtime = (api_gmtime_t)dlsym(RTLD_NEXT, "gmtime");
+    apis->gmtime_r = (api_gmtime_r_t)dlsym(RTLD_NEXT, "gmtime_r");
+    apis->localtime = (api_localtime_t)dlsym(RTLD_NEXT, "localtime");
+    apis->localtime_r = (api_localtime_r_t)dlsym(RTLD_NEXT, "localtime_r");
+    apis->mktime = (api_mktime_t)dlsym(RTLD_NEXT, "mktime");
+
+    apis->clock_gettime = (api_clock_gettime_t)dlsym(RTLD_NEXT, "clock_gettime");
+    apis->gettimeofday = (api_gettimeofday_t)dlsym(RTLD_NEXT, "gettimeofday");
+    apis->nanosleep = (api_nanosleep_t)dlsym(RTLD_NEXT, "nanosleep");
+    apis->clock_nanosleep = (api_clock_nanosleep_t)dlsym(RTLD_NEXT, "clock_nanosleep");
+    apis->usleep = (api_usleep_t)dlsym(RTLD_NEXT, "usleep");
+    apis->sleep = (api_sleep_t)dlsym(RTLD_NEXT, "sleep");
+
+    apis->socket = (api_socket_t)dlsym(RTLD_NEXT, "socket");
+    apis->socketpair = (api_socketpair_t)dlsym(RTLD_NEXT, "socketpair");
+    apis->accept = (api_accept_t)dlsym(RTLD_NEXT, "accept");
+    apis->accept4 = (api_accept4_t)dlsym(RTLD_NEXT, "accept4");
+    apis->connect = (api_connect_t)dlsym(RTLD_NEXT, "connect");
+    apis->send = (api_send_t)dlsym(RTLD_NEXT, "send");
+    apis->sendto = (api_sendto_t)dlsym(RTLD_NEXT, "sendto");
+    apis->sendmsg = (api_sendmsg_t)dlsym(RTLD_NEXT, "sendmsg");
+    apis->sendmmsg = (api_sendmmsg_t)dlsym(RTLD_NEXT, "sendmmsg");
+    apis->recv = (api_recv_t)dlsym(RTLD_NEXT, "recv");
+    apis->recvfrom = (api_recvfrom_t)dlsym(RTLD_NEXT, "recvfrom");
+    apis->recvmsg = (api_recvmsg_t)dlsym(RTLD_NEXT, "recvmsg");
+    apis->recvmmsg = (api_recvmmsg_t)dlsym(RTLD_NEXT, "recvmmsg");
+    apis->poll = (api_poll_t)dlsym(RTLD_NEXT, "poll");
+    apis->select = (api_select_t)dlsym(RTLD_NEXT, "select");
+    apis->epoll_wait = (api_epoll_wait_t)dlsym(RTLD_NEXT, "epoll_wait");
+    apis->epoll_ctl = (api_epoll_ctl_t)dlsym(RTLD_NEXT, "epoll_ctl");
+
+    apis->fork = (api_fork_t)dlsym(RTLD_NEXT, "fork");
+    apis->posix_spawn = (api_posix_spawn_t)dlsym(RTLD_NEXT, "posix_spawn");
+    apis->posix_spawnp = (api_posix_spawnp_t)dlsym(RTLD_NEXT, "posix_spawnp");
+    apis->execve = (api_execve_t)dlsym(RTLD_NEXT, "execve");
+    apis->execv = (api_execv_t)dlsym(RTLD_NEXT, "execv");
+    apis->execvp = (api_execvp_t)dlsym(RTLD_NEXT, "execvp");
+    apis->execvpe = (api_execvpe_t)dlsym(RTLD_NEXT, "execvpe");
+    apis->system = (api_system_t)dlsym(RTLD_NEXT, "system");
+    apis->popen = (api_popen_t)dlsym(RTLD_NEXT, "popen");
+    apis->pclose = (api_pclose_t)dlsym(RTLD_NEXT, "pclose");
+    apis->wait = (api_wait_t)dlsym(RTLD_NEXT, "wait");
+    apis->waitpid = (api_waitpid_t)dlsym(RTLD_NEXT, "waitpid");
+    apis->wait4 = (api_wait4_t)dlsym(RTLD_NEXT, "wait4");
+
+    apis->dlopen = (api_dlopen_t)dlsym(RTLD_NEXT, "dlopen");
+    apis->dlmopen = (api_dlmopen_t)dlsym(RTLD_NEXT, "dlmopen");
+    apis->dlclose = (api_dlclose_t)dlsym(RTLD_NEXT, "dlclose");
+    apis->__libc_start_main = (api___libc_start_main_t)dlsym(RTLD_NEXT, "__libc_start_main");
+
+    apis->stat = (api_stat_t)dlsym(RTLD_NEXT, "stat");
+    apis->lstat = (api_lstat_t)dlsym(RTLD_NEXT, "lstat");
+    apis->fstat = (api_fstat_t)dlsym(RTLD_NEXT, "fstat");
+    apis->fstatat = (api_fstatat_t)dlsym(RTLD_NEXT, "fstatat");
+    apis->statx = (api_statx_t)dlsym(RTLD_NEXT, "statx");
+    apis->access = (api_access_t)dlsym(RTLD_NEXT, "access");
+    apis->faccessat = (api_faccessat_t)dlsym(RTLD_NEXT, "faccessat");
+    apis->opendir = (api_opendir_t)dlsym(RTLD_NEXT, "opendir");
+    apis->readdir = (api_readdir_t)dlsym(RTLD_NEXT, "readdir");
+    apis->closedir = (api_closedir_t)dlsym(RTLD_NEXT, "closedir");
+    apis->realpath = (api_realpath_t)dlsym(RTLD_NEXT, "realpath");
+    apis->getcwd = (api_getcwd_t)dlsym(RTLD_NEXT, "getcwd");
+    apis->unlink = (api_unlink_t)dlsym(RTLD_NEXT, "unlink");
+    apis->rename = (api_rename_t)dlsym(RTLD_NEXT, "rename");
+    apis->mkdir = (api_mkdir_t)dlsym(RTLD_NEXT, "mkdir");
+    apis->stat64 = (api_stat64_t)dlsym(RTLD_NEXT, "stat64");
+    apis->lstat64 = (api_lstat64_t)dlsym(RTLD_NEXT, "lstat64");
+    apis->fstat64 = (api_fstat64_t)dlsym(RTLD_NEXT, "fstat64");
+    apis->fstatat64 = (api_fstatat64_t)dlsym(RTLD_NEXT, "fstatat64");
+    apis->readdir64 = (api_readdir64_t)dlsym(RTLD_NEXT, "readdir64");
+
+    apis->getenv = (api_getenv_t)dlsym(RTLD_NEXT, "getenv");
+    apis->secure_getenv = (api_secure_getenv_t)dlsym(RTLD_NEXT, "secure_getenv");
+    apis->setenv = (api_setenv_t)dlsym(RTLD_NEXT, "setenv");
+    apis->unsetenv = (api_unsetenv_t)dlsym(RTLD_NEXT, "unsetenv");
+    apis->putenv = (api_putenv_t)dlsym(RTLD_NEXT, "putenv");
+    apis->clearenv = (api_clearenv_t)dlsym(RTLD_NEXT, "clearenv");
+
+    apis->getaddrinfo = (api_getaddrinfo_t)dlsym(RTLD_NEXT, "getaddrinfo");
+    apis->freeaddrinfo = (api_freeaddrinfo_t)dlsym(RTLD_NEXT, "freeaddrinfo");
+    apis->getnameinfo = (api_getnameinfo_t)dlsym(RTLD_NEXT, "getnameinfo");
+    apis->gethostbyname = (api_gethostbyname_t)dlsym(RTLD_NEXT, "gethostbyname");
+    apis->gethostbyname_r = (api_gethostbyname_r_t)dlsym(RTLD_NEXT, "gethostbyname_r");
+    apis->getservbyname = (api_getservbyname_t)dlsym(RTLD_NEXT, "getservbyname");
+    apis->getpwnam = (api_getpwnam_t)dlsym(RTLD_NEXT, "getpwnam");
+    apis->getpwuid = (api_getpwuid_t)dlsym(RTLD_NEXT, "getpwuid");
+    apis->getgrnam = (api_getgrnam_t)dlsym(RTLD_NEXT, "getgrnam");
+
+    apis->hcreate = (api_hcreate_t)dlsym(RTLD_NEXT, "hcreate");
+    apis->hsearch = (api_hsearch_t)dlsym(RTLD_NEXT, "hsearch");
+    apis->hdestroy = (api_hdestroy_t)dlsym(RTLD_NEXT, "hdestroy");
+    apis->hcreate_r = (api_hcreate_r_t)dlsym(RTLD_NEXT, "hcreate_r");
+    apis->hsearch_r = (api_hsearch_r_t)dlsym(RTLD_NEXT, "hsearch_r");
+    apis->hdestroy_r = (api_hdestroy_r_t)dlsym(RTLD_NEXT, "hdestroy_r");
+    apis->tsearch = (api_tsearch_t)dlsym(RTLD_NEXT, "tsearch");
+    apis->tfind = (api_tfind_t)dlsym(RTLD_NEXT, "tfind");
+    apis->tdelete = (api_tdelete_t)dlsym(RTLD_NEXT, "tdelete");
+    apis->twalk = (api_twalk_t)dlsym(RTLD_NEXT, "twalk");
+    apis->lsearch = (api_lsearch_t)dlsym(RTLD_NEXT, "lsearch");
+    apis->lfind = (api_lfind_t)dlsym(RTLD_NEXT, "lfind");
+
+    apis->regcomp = (api_regcomp_t)dlsym(RTLD_NEXT, "regcomp");
+    apis->regexec = (api_regexec_t)dlsym(RTLD_NEXT, "regexec");
+    apis->regerror = (api_regerror_t)dlsym(RTLD_NEXT, "regerror");
+    apis->regfree = (api_regfree_t)dlsym(RTLD_NEXT, "regfree");
+    apis->fnmatch = (api_fnmatch_t)dlsym(RTLD_NEXT, "fnmatch");
+    apis->glob = (api_glob_t)dlsym(RTLD_NEXT, "glob");
+    apis->globfree = (api_globfree_t)dlsym(RTLD_NEXT, "globfree");
+    apis->wordexp = (api_wordexp_t)dlsym(RTLD_NEXT, "wordexp");
+    apis->wordfree = (api_wordfree_t)dlsym(RTLD_NEXT, "wordfree");
+
+    // PCRE2 may only be loaded later, so its symbols are resolved on the first call with `libsee_resolve_lazily`
+#if LIBSEE_BLAS
+    // BLAS may only be loaded later, so its symbols are resolved on the first call with `libsee_resolve_lazily`
+#endif
+#if LIBSEE_ZLIB
+    // zlib may only be loaded later, so its symbols are resolved on the first call with `libsee_resolve_lazily`
+#endif
+
+#if defined(__STDC_LIB_EXT1__)
+    apis->strcpy_s = (api_strcpy_s_t)dlsym(RTLD_NEXT, "strcpy_s");
+    apis->strncpy_s = (api_strncpy_s_t)dlsym(RTLD_NEXT, "strncpy_s");
+    apis->strcat_s = (api_strcat_s_t)dlsym(RTLD_NEXT, "strcat_s");
+    apis->strncat_s = (api_strncat_s_t)dlsym(RTLD_NEXT, "strncat_s");
+    apis->strnlen_s = (api_strnlen_s_t)dlsym(RTLD_NEXT, "strnlen_s");
+    apis->strtok_s = (api_strtok_s_t)dlsym(RTLD_NEXT, "strtok_s");
+    apis->memset_s = (api_memset_s_t)dlsym(RTLD_NEXT, "memset_s");
+    apis->memcpy_s = (api_memcpy_s_t)dlsym(RTLD_NEXT, "memcpy_s");
+    apis->memmove_s = (api_memmove_s_t)dlsym(RTLD_NEXT, "memmove_s");
+    apis->strerror_s = (api_strerror_s_t)dlsym(RTLD_NEXT, "strerror_s");
+    apis->qsort_s = (api_qsort_s_t)dlsym(RTLD_NEXT, "qsort_s");
+    apis->bsearch_s = (api_bsearch_s_t)dlsym(RTLD_NEXT, "bsearch_s");
+
+    apis->asctime_s = (api_asctime_s_t)dlsym(RTLD_NEXT, "asctime_s");
+    apis->ctime_s = (api_ctime_s_t)dlsym(RTLD_NEXT, "ctime_s");
+    apis->gmtime_s = (api_gmtime_s_t)dlsym(RTLD_NEXT, "gmtime_s");
+    apis->localtime_s = (api_localtime_s_t)dlsym(RTLD_NEXT, "localtime_s");
+#endif
+}
+
+/**
+ *  @brief  Prints an unsigned integer, grouping the digits in thousands, unless the separator is zero.
+ */
+size_t libsee_print_size(size_t number, char thousands_separator, char *buffer) {
+    if (number == 0) {
+        buffer[0] = '0';
+        buffer[1] = '\0'; // Null terminate the string
+        return 1;
+    }
+
+    size_t temp = number;
+    size_t digits = 0;
+    while (temp > 0) {
+        temp /= 10;
+        digits++;
+    }
+
+    // Calculate the total length including commas
+    size_t total_length = digits + (thousands_separator ? (digits - 1) / 3 : 0);
+
+    temp = number;
+    size_t index = total_length; // Start filling the buffer from the end
+    buffer[index--] = '\0';      // Null-terminate the string
+
+    for (size_t i = 0; i < digits; i++) {
+        // Insert comma every three digits
+        if (thousands_separator && i > 0 && i % 3 == 0) buffer[index--] = thousands_separator;
+        buffer[index--] = (temp % 10) + '0'; // Convert digit to character
+        temp /= 10;
+    }
+
+    return total_length;
+}
+
+size_t libsee_print_double(double number, char thousands_separator, size_t decimal_points, char *buffer) {
+    // Handle negative numbers
+    if (number < 0) {
+        *buffer++ = '-';
+        number = -number; // Make the number positive for formatting
+    }
+
+    // Split number into integer and fractional parts
+    double integer_part = (size_t)number;
+    double fractional_part = number - integer_part;
+
+    // Convert integer part to string with thousands separator
+    size_t integer_length = libsee_print_size((size_t)integer_part, thousands_separator, buffer);
+
+    // Add decimal point
+    buffer[integer_length] = '.';
+    size_t total_length = integer_length + 1; // +1 for the decimal point
+
+    // Handle fractional part
+    for (size_t i = 0; i < decimal_points; i++) {
+        fractional_part *= 10;                   // Shift fractional part to the left
+        int digit = (int)(fractional_part) % 10; // Get next digit
+        buffer[total_length++] = '0' + digit;    // Convert digit to character and store
+    }
+
+    // Null-terminate the string
+    buffer[total_length] = '\0';
+
+    return total_length; // Return length of the string
+}
+
+size_t libsee_pad_buffer(char *buffer, size_t current_length, size_t target_length) {
+    while (current_length < target_length) { buffer[current_length++] = ' '; }
+    buffer[current_length] = '\0'; // Null-terminate the padded string
+    return current_length;          // Longer contents are kept intact
+}
+
+size_t libsee_append_string(char *buffer, size_t length, char const *string) {
+    while (*string) buffer[length++] = *string++;
+    buffer[length] = '\0';
+    return length;
+}
+
+/**
+ *  @brief  Prints a single "label, value" line, aligned with the columns of the main report.
+ */
+void libsee_print_stat(char const *label, size_t value) {
+    char stat_line[256];
+    size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+    stat_line_length = libsee_append_string(stat_line, stat_line_length, label);
+    stat_line[stat_line_length++] = ',';
+    stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+    stat_line_length += libsee_print_size(value, ' ', stat_line + stat_line_length);
+    stat_line[stat_line_length++] = '\n';
+    syscall_print(stat_line, stat_line_length);
+}
+
+/**
+ *  @brief  Prints the non-empty buckets of a histogram as "[lower, upper], count" lines.
+ */
+void libsee_print_histogram(char const *title, libsee_histogram const *histogram) {
+    char stat_line[256];
+    size_t stat_line_length = libsee_append_string(stat_line, 0, title);
+    stat_line[stat_line_length++] = '\n';
+    syscall_print(stat_line, stat_line_length);
+
+    for (size_t bucket = 0; bucket < LIBSEE_HISTOGRAM_BUCKETS; bucket++) {
+        size_t count = histogram->buckets[bucket];
+        if (count == 0) continue;
+        size_t lower = bucket ? (size_t)1 << (bucket - 1) : 0;
+        size_t upper = bucket ? lower + (lower - 1) : 0;
+        stat_line_length = libsee_append_string(stat_line, 0, "  [");
+        stat_line_length += libsee_print_size(lower, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+        stat_line_length += libsee_print_size(upper, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, "],");
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+        stat_line_length += libsee_print_size(count, ' ', stat_line + stat_line_length);
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
+}
+
+/**
+ *  @brief  Reports the shapes of arrays passed to `qsort`, showing if an adaptive
+ *          or an insertion sort would do better on the most common inputs.
+ */
+void libsee_print_sort_stats(void) {
+    libsee_sort_stats const *stats = &libsee_qsort_stats;
+    if (stats->calls == 0) return;
+
+    libsee_print_histogram("qsort element sizes, bytes:", &stats->element_sizes);
+    libsee_print_histogram("qsort element counts:", &stats->element_counts);
+    if (stats->sampled_calls == 0) return;
+
+    char stat_line[256];
+    size_t stat_line_length = libsee_append_string(stat_line, 0, "qsort presortedness, sampling 1 in ");
+    stat_line_length += libsee_print_size(LIBSEE_QSORT_SAMPLING_PERIOD, ' ', stat_line + stat_line_length);
+    stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls:\n");
+    syscall_print(stat_line, stat_line_length);
+    libsee_print_stat("sampled calls", stats->sampled_calls);
+    libsee_print_stat("already sorted", stats->sampled_sorted);
+    libsee_print_stat("reverse sorted", stats->sampled_reversed);
+    libsee_print_stat("nearly sorted", stats->sampled_nearly_sorted);
+    libsee_print_stat("compared pairs", stats->sampled_pairs);
+    libsee_print_stat("ascending runs", stats->sampled_runs);
+}
+
+void libsee_append_exponent(char *buffer, size_t *length, long exponent) {
+    *length = libsee_append_string(buffer, *length, exponent < 0 ? "2^-" : "2^");
+    *length += libsee_print_size((size_t)(exponent < 0 ? -exponent : exponent), ' ', buffer + *length);
+}
+
+static char const *libsee_math_function_names[] = {"exp", "expf", "expl", "log", "logf", "logl", "pow", "powf",
+    "powl", "sin", "sinf", "sinl", "cos", "cosf", "cosl", "sqrt", "sqrtf", "sqrtl", "fmod", "fmodf", "fmodl", "erf",
+    "erff", "erfl", "lgamma", "lgammaf", "lgammal"};
+COMPILE_TIME_ASSERT(sizeof(libsee_math_function_names) / sizeof(char const *) == LIBSEE_MATH_FUNCTIONS,
+    number_of_math_functions_must_be_equal);
+
+/**
+ *  @brief  Reports the classes and magnitudes of arguments passed to LibM functions,
+ *          highlighting the inputs that are likely to hit the slow paths.
+ */
+void libsee_print_math_stats(void) {
+    for (size_t i = 0; i < LIBSEE_MATH_FUNCTIONS; i++) {
+        libsee_math_stats const *stats = &libsee_math_inputs.indexed[i];
+        size_t finite = 0;
+        for (size_t bucket = 0; bucket < LIBSEE_MATH_MAGNITUDE_BUCKETS; bucket++) finite += stats->magnitudes[bucket];
+        if (finite + stats->zeros + stats->nans + stats->infinities == 0) continue;
+
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, libsee_math_function_names[i]);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " arguments:\n");
+        syscall_print(stat_line, stat_line_length);
+        if (stats->zeros) libsee_print_stat("zeros", stats->zeros);
+        if (stats->denormals) libsee_print_stat("denormals", stats->denormals);
+        if (stats->nans) libsee_print_stat("NaNs", stats->nans);
+        if (stats->infinities) libsee_print_stat("infinities", stats->infinities);
+
+        for (size_t bucket = 0; bucket < LIBSEE_MATH_MAGNITUDE_BUCKETS; bucket++) {
+            size_t count = stats->magnitudes[bucket];
+            if (count == 0) continue;
+            long exponent = (long)bucket + LIBSEE_MATH_MIN_EXPONENT - 1;
+            stat_line_length = libsee_append_string(stat_line, 0, "  |x| in ");
+            if (bucket == 0) {
+                stat_line_length = libsee_append_string(stat_line, stat_line_length, "(0, ");
+                libsee_append_exponent(stat_line, &stat_line_length, exponent + 1);
+                stat_line_length = libsee_append_string(stat_line, stat_line_length, "),");
+            }
+            else if (bucket == LIBSEE_MATH_MAGNITUDE_BUCKETS - 1) {
+                stat_line[stat_line_length++] = '[';
+                libsee_append_exponent(stat_line, &stat_line_length, exponent);
+                stat_line_length = libsee_append_string(stat_line, stat_line_length, ", inf),");
+            }
+            else {
+                stat_line[stat_line_length++] = '[';
+                libsee_append_exponent(stat_line, &stat_line_length, exponent);
+                stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+                libsee_append_exponent(stat_line, &stat_line_length, exponent + 1);
+                stat_line_length = libsee_append_string(stat_line, stat_line_length, "),");
+            }
+            stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+            stat_line_length += libsee_print_size(count, ' ', stat_line + stat_line_length);
+            stat_line[stat_line_length++] = '\n';
+            syscall_print(stat_line, stat_line_length);
+        }
+    }
+}
+
+static char const *libsee_multibyte_function_names[] = {
+    "wcstombs", "mbrtowc", "mbstowcs", "wcrtomb", "wcsrtombs", "mbrlen", "mbsrtowcs", "btowc"};
+COMPILE_TIME_ASSERT(sizeof(libsee_multibyte_function_names) / sizeof(char const *) ==
+                        sizeof(multibyte_calls) / sizeof(size_t),
+    number_of_multibyte_functions_must_be_equal);
+
+/**
+ *  @brief  Reports the multibyte conversions performed outside of UTF-8 locales, that take the generic slow paths.
+ */
+void libsee_print_multibyte_stats(void) {
+    size_t total_calls = 0;
+    for (size_t i = 0; i < sizeof(multibyte_calls) / sizeof(size_t); i++)
+        total_calls += libsee_non_utf8_calls.indexed[i];
+    if (total_calls == 0) return;
+
+    syscall_print("multibyte conversions under non-UTF-8 locales:\n", 47);
+    for (size_t i = 0; i < sizeof(multibyte_calls) / sizeof(size_t); i++)
+        if (libsee_non_utf8_calls.indexed[i])
+            libsee_print_stat(libsee_multibyte_function_names[i], libsee_non_utf8_calls.indexed[i]);
+}
+
+/**
+ *  @brief  Reports the average number of wide characters transferred per call of the wide stream functions,
+ *          and the bytes they take in the multibyte encoding, wherever those are known.
+ *          Expects the counters to be aggregated into the first thread.
+ */
+void libsee_print_wide_stdio_stats(void) {
+    thread_local_counters const *calls = &libsee_thread_calls[0];
+    thread_local_counters const *bytes = &libsee_thread_bytes[0];
+    libsee_wide_stdio_stats const *characters = &libsee_wide_characters;
+    struct {
+        char const *function_name;
+        size_t calls, characters, bytes;
+    } stats[] = {
+        {"fgetwc", calls->named.fgetwc, characters->fgetwc, bytes->named.fgetwc},
+        {"getwc", calls->named.getwc, characters->getwc, bytes->named.getwc},
+        {"fgetws", calls->named.fgetws, characters->fgetws, bytes->named.fgetws},
+        {"fputwc", calls->named.fputwc, characters->fputwc, bytes->named.fputwc},
+        {"putwc", calls->named.putwc, characters->putwc, bytes->named.putwc},
+        {"fputws", calls->named.fputws, characters->fputws, bytes->named.fputws},
+        {"vwprintf", calls->named.vwprintf, characters->vwprintf, 0},
+        {"vfwprintf", calls->named.vfwprintf, characters->vfwprintf, 0},
+        {"vswprintf", calls->named.vswprintf, characters->vswprintf, bytes->named.vswprintf},
+    };
+
+    int printed_header = 0;
+    for (size_t i = 0; i < sizeof(stats) / sizeof(stats[0]); i++) {
+        if (stats[i].calls == 0) continue;
+        if (!printed_header) syscall_print("wide stdio characters and bytes per call:\n", 42), printed_header = 1;
+
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, stats[i].function_name);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+        stat_line_length += libsee_print_double(
+            (double)stats[i].characters / (double)stats[i].calls, ' ', 2, stat_line + stat_line_length);
+        if (stats[i].bytes) {
+            stat_line[stat_line_length++] = ',';
+            stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 60);
+            stat_line_length += libsee_print_double(
+                (double)stats[i].bytes / (double)stats[i].calls, ' ', 2, stat_line + stat_line_length);
+        }
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
+}
+
+size_t libsee_print_hex(size_t number, char *buffer) {
+    char const *digits = "0123456789abcdef";
+    size_t count_digits = 1;
+    while (count_digits < sizeof(size_t) * 2 && (number >> (count_digits * 4))) count_digits++;
+    buffer[0] = '0', buffer[1] = 'x';
+    for (size_t i = 0; i < count_digits; i++) buffer[2 + count_digits - 1 - i] = digits[(number >> (i * 4)) & 0xF];
+    buffer[2 + count_digits] = '\0';
+    return 2 + count_digits;
+}
+
+/**
+ *  @brief  Appends a human-readable call-site description, like "main+0x1f" or "libfoo.so+0x1234".
+ */
+size_t libsee_append_call_site(char *buffer, size_t length, size_t address) {
+    Dl_info info;
+    if (!dladdr((void *)address, &info)) return length + libsee_print_hex(address, buffer + length);
+    size_t base = (size_t)(info.dli_sname ? info.dli_saddr : info.dli_fbase);
+    char const *name = info.dli_sname;
+    if (!name && info.dli_fname) {
+        name = info.dli_fname;
+        for (char const *cursor = name; *cursor; cursor++)
+            if (*cursor == '/') name = cursor + 1;
+    }
+    if (!name || !*name) return length + libsee_print_hex(address, buffer + length);
+
+    // Keep the symbol name short enough to fit into the line
+    size_t name_length = 0;
+    while (name[name_length] && name_length < 48) buffer[length++] = name[name_length++];
+    buffer[length++] = '+';
+    return length + libsee_print_hex(address - base, buffer + length);
+}
+
+/*
+ *  Other threads may still be updating the shared tables while they are being reported, so the printers
+ *  rank the pointers to the published slots in a short local array, instead of reordering the slots.
+ */
+typedef size_t (*libsee_slot_score_t)(void const *slot);
+
+/**
+ *  @brief  Picks the published slots with the highest non-zero scores, in the descending order of scores.
+ *  @return Number of picked slots, at most `LIBSEE_MAX_REPORTED_CALL_SITES`.
+ */
+size_t libsee_top_slots(void const *slots, size_t slot_size, size_t capacity, libsee_slot_score_t score,
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES]) {
+    size_t top_scores[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = 0;
+    for (size_t i = 0; i != capacity; i++) {
+        void const *slot = (char const *)slots + i * slot_size;
+        if (!libsee_slot_is_published(__atomic_load_n((size_t const *)slot, __ATOMIC_ACQUIRE))) continue;
+        size_t slot_score = score(slot);
+        if (!slot_score || (count == LIBSEE_MAX_REPORTED_CALL_SITES && slot_score <= top_scores[count - 1]))
+            continue;
+        // Insertion into the sorted array, evicting the last entry, once it is full
+        size_t position = count < LIBSEE_MAX_REPORTED_CALL_SITES ? count++ : count - 1;
+        for (; position && top_scores[position - 1] < slot_score; position--)
+            top[position] = top[position - 1], top_scores[position] = top_scores[position - 1];
+        top[position] = slot, top_scores[position] = slot_score;
+    }
+    return count;
+}
+
+size_t libsee_keyed_score(void const *slot) { return ((libsee_keyed_stats const *)slot)->cycles; }
+
+/**
+ *  @brief  Prints the most expensive entries of a keyed table.
+ *  @param  origins_are_call_sites Whether origins should be symbolized as addresses or printed as thread IDs.
+ */
+void libsee_print_keyed_stats(
+    char const *title, libsee_keyed_stats const *slots, size_t capacity, int origins_are_call_sites) {
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = libsee_top_slots(slots, sizeof(libsee_keyed_stats), capacity, libsee_keyed_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_keyed_stats const *slot = (libsee_keyed_stats const *)top[reported];
+        if (reported == 0) {
+            char stat_line[256];
+            size_t stat_line_length = libsee_append_string(stat_line, 0, title);
+            stat_line[stat_line_length++] = '\n';
+            syscall_print(stat_line, stat_line_length);
+        }
+
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->function_name);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 20);
+        if (origins_are_call_sites)
+            stat_line_length = libsee_append_call_site(stat_line, stat_line_length, slot->origin);
+        else {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, "thread ");
+            stat_line_length += libsee_print_size(slot->origin, 0, stat_line + stat_line_length);
+        }
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 90);
+        stat_line_length += libsee_print_size(slot->cycles, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles, ");
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls\n");
+        syscall_print(stat_line, stat_line_length);
+    }
+}
+
+/**
+ *  @brief  Flags the functions, that take process-wide locks, and were called too often.
+ */
+void libsee_print_rate_hazard(char const *function_name, libsee_rate_stats const *rate, size_t threshold) {
+    if (rate->peak_calls <= threshold) return;
+    char stat_line[256];
+    size_t stat_line_length = libsee_append_string(stat_line, 0, "scaling hazard: ");
+    stat_line_length = libsee_append_string(stat_line, stat_line_length, function_name);
+    stat_line_length = libsee_append_string(stat_line, stat_line_length, " takes a global lock and was called ");
+    stat_line_length += libsee_print_size(rate->peak_calls, ' ', stat_line + stat_line_length);
+    stat_line_length = libsee_append_string(stat_line, stat_line_length, " times within a second\n");
+    syscall_print(stat_line, stat_line_length);
+}
+
+size_t libsee_append_cycles_per_byte(char *buffer, size_t length, size_t cycles, size_t bytes) {
+    length += libsee_print_double(bytes ? (double)cycles / (double)bytes : 0, ' ', 2, buffer + length);
+    length = libsee_append_string(buffer, length, " cycles/byte over ");
+    length += libsee_print_size(bytes, ' ', buffer + length);
+    return libsee_append_string(buffer, length, " bytes");
+}
+
+/**
+ *  @brief  Compares the per-byte costs of locking and `_unlocked` character I/O on every stream.
+ */
+void libsee_print_stream_locking_stats(void) {
+    int printed_header = 0;
+    for (size_t i = 0; i < LIBSEE_MAX_STREAMS; i++) {
+        libsee_stream_stats const *slot = &libsee_streams[i];
+        if (slot->locked_calls + slot->unlocked_calls == 0) continue;
+        if (!printed_header) syscall_print("character I/O per stream:\n", 26), printed_header = 1;
+
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  fd ");
+        stat_line_length += libsee_print_size((size_t)slot->descriptor, 0, stat_line + stat_line_length);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 20);
+        if (slot->locked_calls) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, "locked: ");
+            stat_line_length = libsee_append_cycles_per_byte(
+                stat_line, stat_line_length, slot->locked_cycles, slot->locked_bytes);
+        }
+        if (slot->locked_calls && slot->unlocked_calls)
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+        if (slot->unlocked_calls) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, "unlocked: ");
+            stat_line_length = libsee_append_cycles_per_byte(
+                stat_line, stat_line_length, slot->unlocked_cycles, slot->unlocked_bytes);
+        }
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
+}
+
+/**
+ *  @brief  Reports how often the bulk and formatted I/O calls were served from the stream buffers,
+ *          and how many bytes every refill or flush moved, to spot the streams worth larger buffers.
+ */
+void libsee_print_stream_buffering_stats(void) {
+    int printed_header = 0;
+    for (size_t i = 0; i < LIBSEE_MAX_STREAMS; i++) {
+        libsee_stream_stats const *slot = &libsee_streams[i];
+        size_t calls = slot->buffered_calls + slot->kernel_calls;
+        if (calls == 0) continue;
+        if (!printed_header) syscall_print("stream buffering:\n", 18), printed_header = 1;
+
+        char const *mode_name = slot->buffer_mode == _IONBF   ? "unbuffered"
+                                : slot->buffer_mode == _IOLBF ? "line-buffered"
+                                                              : "fully-buffered";
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  fd ");
+        stat_line_length += libsee_print_size((size_t)slot->descriptor, 0, stat_line + stat_line_length);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 20);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, mode_name);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+        stat_line_length += libsee_print_size(slot->buffer_size, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(
+            stat_line, stat_line_length, slot->buffer_configured ? " bytes (setvbuf), " : " bytes (default), ");
+        double hit_ratio = 100.0 * (double)slot->buffered_calls / (double)calls;
+        stat_line_length += libsee_print_double(hit_ratio, ' ', 2, stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, "% of ");
+        stat_line_length += libsee_print_size(calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls buffered");
+        if (slot->kernel_calls) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+            size_t bytes_per_transfer = slot->kernel_bytes / slot->kernel_calls;
+            stat_line_length += libsee_print_size(bytes_per_transfer, ' ', stat_line + stat_line_length);
+            stat_line_length =
+                libsee_append_string(stat_line, stat_line_length, " bytes per refilling or flushing call");
+        }
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
+}
+
+size_t libsee_path_score(void const *slot) { return ((libsee_path_stats const *)slot)->cycles; }
+
+/**
+ *  @brief  Lists the files, that consumed the most cycles in stream I/O, with the bytes moved and seeks issued.
+ */
+void libsee_print_path_stats(void) {
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = libsee_top_slots(libsee_paths, sizeof(libsee_path_stats), LIBSEE_MAX_PATHS, libsee_path_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_path_stats const *slot = (libsee_path_stats const *)top[reported];
+        if (reported == 0) syscall_print("most expensive files:\n", 22);
+        char stat_line[LIBSEE_MAX_PATH_LENGTH + 256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->pattern);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 60);
+        stat_line_length += libsee_print_size(slot->cycles, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles, ");
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls, ");
+        stat_line_length += libsee_print_size(slot->bytes, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " bytes, ");
+        stat_line_length += libsee_print_size(slot->seeks, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " seeks\n");
+        syscall_print(stat_line, stat_line_length);
+    }
+}
+
+/**
+ *  @brief  Classifies the reads from every file as sequential, strided, or random,
+ *          suggesting the alternatives to stdio for the access patterns it handles poorly.
+ */
+void libsee_print_access_patterns(void) {
+    int printed_header = 0;
+    for (size_t i = 0; i < LIBSEE_MAX_PATHS; i++) {
+        libsee_path_stats const *slot = &libsee_paths[i];
+        size_t reads = slot->sequential_reads + slot->strided_reads + slot->random_reads;
+        size_t bytes = slot->sequential_bytes + slot->strided_bytes + slot->random_bytes;
+        if (reads == 0) continue;
+        if (!printed_header) syscall_print("file access patterns:\n", 22), printed_header = 1;
+
+        char stat_line[LIBSEE_MAX_PATH_LENGTH + 256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->pattern);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 60);
+        stat_line_length += libsee_print_size(bytes, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " bytes in ");
+        stat_line_length += libsee_print_size(reads, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " reads: ");
+        double const percent = 100.0 / (double)bytes;
+        stat_line_length += libsee_print_double(slot->sequential_bytes * percent, ' ', 2, stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, "% sequential, ");
+        stat_line_length += libsee_print_double(slot->strided_bytes * percent, ' ', 2, stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, "% strided, ");
+        stat_line_length += libsee_print_double(slot->random_bytes * percent, ' ', 2, stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, "% random\n");
+        syscall_print(stat_line, stat_line_length);
+
+        // Every seek discards the stdio buffer, so non-sequential patterns pay for refills they don't use
+        char const *advice = NULL;
+        if (slot->random_bytes * 2 > bytes)
+            advice = "    mostly random: prefer `pread` or `mmap` over `fseek` and `fread`\n";
+        else if (slot->strided_bytes * 2 > bytes)
+            advice = "    mostly strided: prefer `mmap`, or `POSIX_FADV_WILLNEED` ahead of the stride\n";
+        else if (slot->sequential_bytes * 2 > bytes && slot->sequential_bytes > 64 * BUFSIZ)
+            advice = "    mostly sequential: prefer a larger `setvbuf` buffer and `POSIX_FADV_SEQUENTIAL`\n";
+        if (advice) syscall_print(advice, libsee_apis.strlen(advice));
+    }
+}
+
+/**
+ *  @brief  Reports the sockets, that moved the most bytes, and the batching distributions.
+ */
+void libsee_print_socket_stats(void) {
+    size_t previous_bytes = (size_t)-1, previous_descriptor = (size_t)-1;
+    for (size_t reported = 0; reported < LIBSEE_MAX_REPORTED_CALL_SITES; reported++) {
+        // The table is indexed by descriptors, so instead of sorting it in-place, on every pass we pick
+        // the busiest socket ranked after the previously printed one, breaking ties by the descriptor
+        size_t top = (size_t)-1, top_bytes = 0;
+        for (size_t fd = 0; fd < LIBSEE_MAX_DESCRIPTORS; fd++) {
+            libsee_socket_stats const *slot = &libsee_sockets[fd];
+            if (slot->sends + slot->receives == 0) continue;
+            size_t bytes = slot->sent_bytes + slot->received_bytes;
+            if (bytes > previous_bytes || (bytes == previous_bytes && fd <= previous_descriptor)) continue;
+            if (top == (size_t)-1 || bytes > top_bytes) top = fd, top_bytes = bytes;
+        }
+        if (top == (size_t)-1) break;
+        previous_bytes = top_bytes, previous_descriptor = top;
+
+        libsee_socket_stats const *slot = &libsee_sockets[top];
+        if (reported == 0) syscall_print("busiest sockets:\n", 17);
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  fd ");
+        stat_line_length += libsee_print_size(top, 0, stat_line + stat_line_length);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 20);
+        stat_line_length += libsee_print_size(slot->sent_bytes, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " bytes in ");
+        stat_line_length += libsee_print_size(slot->sends, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " sends, ");
+        stat_line_length += libsee_print_size(slot->received_bytes, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " bytes in ");
+        stat_line_length += libsee_print_size(slot->receives, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " receives, ");
+        stat_line_length += libsee_print_size(slot->opened, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " sockets opened\n");
+        syscall_print(stat_line, stat_line_length);
+    }
+
+    libsee_batching_stats const *batching = &libsee_batching;
+    thread_local_counters const *calls = &libsee_thread_calls[0];
+    if (calls->named.send + calls->named.sendto + calls->named.sendmsg + calls->named.sendmmsg)
+        libsee_print_histogram("socket bytes per sent message:", &batching->bytes_per_send);
+    if (calls->named.sendmmsg) libsee_print_histogram("sendmmsg messages per call:", &batching->messages_per_sendmmsg);
+    if (calls->named.recvmmsg) libsee_print_histogram("recvmmsg messages per call:", &batching->messages_per_recvmmsg);
+    if (calls->named.epoll_wait)
+        libsee_print_histogram("epoll_wait events per wakeup:", &batching->events_per_epoll_wait);
+    if (calls->named.poll + calls->named.select)
+        libsee_print_histogram("poll and select ready descriptors per wakeup:", &batching->descriptors_per_poll);
+}
+
+/**
+ *  @brief  Reports the process-creation call sites and the parent's resident set size at `fork`,
+ *          to prioritize the migrations from `fork` and `exec` to `posix_spawn`.
+ */
+void libsee_print_process_stats(void) {
+    libsee_process_stats const *stats = &libsee_processes;
+    libsee_print_keyed_stats("process creation call sites:", libsee_spawn_sites, LIBSEE_MAX_SPAWN_SITES, 1);
+    if (!libsee_thread_calls[0].named.fork) return;
+    libsee_print_histogram("parent resident bytes at fork:", &stats->resident_bytes_at_fork);
+    libsee_print_stat("largest parent at fork, bytes", stats->largest_resident_bytes_at_fork);
+}
+
+size_t libsee_library_score(void const *slot) { return ((libsee_loaded_library const *)slot)->nanoseconds; }
+
+/**
+ *  @brief  Reports the libraries taking the longest to load, and how long the startup took before `main`,
+ *          to prioritize lazy loading. The `dlsym` lookups aren't counted, as LibSee doesn't interpose them.
+ */
+void libsee_print_dynamic_loading_stats(void) {
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = libsee_top_slots(libsee_libraries, sizeof(libsee_loaded_library), LIBSEE_MAX_LIBRARIES,
+        libsee_library_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_loaded_library const *slot = (libsee_loaded_library const *)top[reported];
+        if (reported == 0) syscall_print("slowest libraries to load:\n", 27);
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->name);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+        stat_line_length += libsee_print_double((double)slot->nanoseconds / 1e6, ' ', 2, stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " ms, ");
+        stat_line_length += libsee_print_size(slot->opens, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " opens, ");
+        stat_line_length += libsee_print_size(slot->closes, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " closes");
+        if (slot->closes && slot->opens > 1)
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", closed and reopened, keep it open");
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
+
+    libsee_dynamic_loading_stats const *stats = &libsee_dynamic_loading;
+    if (!stats->main_started) return;
+    syscall_print("startup:\n", 9);
+    libsee_print_stat("microseconds before main", stats->nanoseconds_before_main / 1000);
+    libsee_print_stat("libraries opened before main", stats->opens_before_main);
+    libsee_print_stat("microseconds opening them", stats->open_nanoseconds_before_main / 1000);
+}
+
+size_t libsee_path_prefix_score(void const *slot) {
+    // Skip the slots, that are yet to count their first call, as the report divides by it
+    libsee_path_prefix_stats const *stats = (libsee_path_prefix_stats const *)slot;
+    return __atomic_load_n(&stats->calls, __ATOMIC_RELAXED) ? stats->cycles : 0;
+}
+
+/**
+ *  @brief  Lists the path prefixes, that consumed the most cycles in metadata calls, flagging the ones
+ *          querying the same paths again and again, that could cache the results or keep the files open.
+ */
+void libsee_print_path_prefix_stats(void) {
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = libsee_top_slots(libsee_path_prefixes, sizeof(libsee_path_prefix_stats), LIBSEE_MAX_PATH_PREFIXES,
+        libsee_path_prefix_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_path_prefix_stats const *slot = (libsee_path_prefix_stats const *)top[reported];
+        if (reported == 0) syscall_print("filesystem metadata by path prefix:\n", 36);
+        char stat_line[LIBSEE_MAX_PATH_LENGTH + 256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->pattern);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+        stat_line_length += libsee_print_size(slot->cycles, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles, ");
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls, ");
+        stat_line_length += libsee_print_size(slot->cycles / slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles/call");
+        if (slot->repeated_stats) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+            stat_line_length += libsee_print_size(slot->repeated_stats, ' ', stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " of ");
+            stat_line_length += libsee_print_size(slot->stats, ' ', stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " stats repeated within ");
+            stat_line_length += libsee_print_size(LIBSEE_REPEATED_STAT_MILLISECONDS, ' ', stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " ms");
+        }
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
 }
 
-#pragma endregion
+size_t libsee_environment_score(void const *slot) { return ((libsee_environment_variable const *)slot)->cycles; }
+size_t libsee_environment_lookup_score(void const *slot) { return ((libsee_environment_lookup const *)slot)->cycles; }
 
-#pragma region Shared Implementation Components
+/**
+ *  @brief  Finds the stored name of the variable with the given hash, or NULL if its slot was never claimed.
+ */
+char const *libsee_environment_name(size_t hash) {
+    for (size_t i = 0; i < LIBSEE_MAX_ENVIRONMENT_VARIABLES; i++) {
+        libsee_environment_variable const *slot = &libsee_environment_variables[i];
+        if (!libsee_slot_is_published(__atomic_load_n(&slot->key, __ATOMIC_ACQUIRE))) continue;
+        size_t length = 0;
+        while (slot->name[length]) length++;
+        if (libsee_environment_hash(slot->name, length) == hash) return slot->name;
+    }
+    return NULL;
+}
 
-typedef struct libsee_name_stats {
-    char const *function_name;
-    size_t total_cycles;
-    size_t total_calls;
-} libsee_name_stats;
+/**
+ *  @brief  Lists the environment variables, that consumed the most cycles in lookups, and their call sites,
+ *          to find the hot paths, that should cache the values, along with the size of `environ` scanned each time.
+ */
+void libsee_print_environment_stats(void) {
+    size_t lookups = 0, updates = 0;
+    for (size_t i = 0; i < LIBSEE_MAX_ENVIRONMENT_VARIABLES; i++)
+        lookups += libsee_environment_variables[i].lookups, updates += libsee_environment_variables[i].updates;
+    if (!lookups && !updates) return;
+
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = libsee_top_slots(libsee_environment_lookups, sizeof(libsee_environment_lookup),
+        LIBSEE_MAX_CALL_SITES, libsee_environment_lookup_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_environment_lookup const *slot = (libsee_environment_lookup const *)top[reported];
+        char const *name = libsee_environment_name(slot->variable);
+        if (reported == 0) syscall_print("environment lookup call sites:\n", 31);
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, name ? name : "?");
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 20);
+        stat_line_length = libsee_append_call_site(stat_line, stat_line_length, slot->origin);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 90);
+        stat_line_length += libsee_print_size(slot->cycles, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles, ");
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls\n");
+        syscall_print(stat_line, stat_line_length);
+    }
 
-void libsee_initialize(void) {
+    count = libsee_top_slots(libsee_environment_variables, sizeof(libsee_environment_variable),
+        LIBSEE_MAX_ENVIRONMENT_VARIABLES, libsee_environment_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_environment_variable const *slot = (libsee_environment_variable const *)top[reported];
+        if (reported == 0) syscall_print("environment variables:\n", 23);
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->name);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+        stat_line_length += libsee_print_size(slot->cycles, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles, ");
+        stat_line_length += libsee_print_size(slot->lookups, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " lookups, ");
+        stat_line_length += libsee_print_size(slot->misses, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " unset, ");
+        stat_line_length += libsee_print_size(slot->updates, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " updates\n");
+        syscall_print(stat_line, stat_line_length);
+    }
 
-    // Initialize all the cycles to zeros, without using `memset`
-    size_t *cycles = libsee_thread_cycles[0].indexed;
-    size_t *calls = libsee_thread_calls[0].indexed;
-    size_t total_counters_per_thread = sizeof(thread_local_counters) / sizeof(size_t);
-    size_t total_counters_across_threads = LIBSEE_MAX_THREADS * total_counters_per_thread;
-    for (size_t i = 0; i < total_counters_across_threads; i++) cycles[i] = calls[i] = 0;
+    size_t variables = 0, bytes = 0;
+    for (char **it = environ; it && *it; ++it, ++variables)
+        for (char const *c = *it; *c; ++c) ++bytes;
+    syscall_print("environment:\n", 13);
+    libsee_print_stat("variables in environ", variables);
+    libsee_print_stat("bytes in environ", bytes);
+    libsee_print_stat("lookups", lookups);
+    libsee_print_stat("updates", updates);
+}
 
-    // Load the symbols from the underlying implementation
-    real_apis *apis = &libsee_apis;
+size_t libsee_resolved_name_score(void const *slot) { return ((libsee_resolved_name const *)slot)->nanoseconds; }
 
-    apis->strcpy = (api_strcpy_t)dlsym(RTLD_NEXT, "strcpy");
-    apis->strncpy = (api_strncpy_t)dlsym(RTLD_NEXT, "strncpy");
-    apis->strcat = (api_strcat_t)dlsym(RTLD_NEXT, "strcat");
-    apis->strncat = (api_strncat_t)dlsym(RTLD_NEXT, "strncat");
-    apis->strxfrm = (api_strxfrm_t)dlsym(RTLD_NEXT, "strxfrm");
-    apis->strlen = (api_strlen_t)dlsym(RTLD_NEXT, "strlen");
-    apis->strcmp = (api_strcmp_t)dlsym(RTLD_NEXT, "strcmp");
-    apis->strncmp = (api_strncmp_t)dlsym(RTLD_NEXT, "strncmp");
-    apis->strcoll = (api_strcoll_t)dlsym(RTLD_NEXT, "strcoll");
-    apis->strchr = (api_strchr_t)dlsym(RTLD_NEXT, "strchr");
-    apis->strrchr = (api_strrchr_t)dlsym(RTLD_NEXT, "strrchr");
-    apis->strspn = (api_strspn_t)dlsym(RTLD_NEXT, "strspn");
-    apis->strcspn = (api_strcspn_t)dlsym(RTLD_NEXT, "strcspn");
-    apis->strpbrk = (api_strpbrk_t)dlsym(RTLD_NEXT, "strpbrk");
-    apis->strstr = (api_strstr_t)dlsym(RTLD_NEXT, "strstr");
-    apis->strtok = (api_strtok_t)dlsym(RTLD_NEXT, "strtok");
-    apis->memchr = (api_memchr_t)dlsym(RTLD_NEXT, "memchr");
-    apis->memcmp = (api_memcmp_t)dlsym(RTLD_NEXT, "memcmp");
-    apis->memset = (api_memset_t)dlsym(RTLD_NEXT, "memset");
-    apis->memcpy = (api_memcpy_t)dlsym(RTLD_NEXT, "memcpy");
-    apis->memmove = (api_memmove_t)dlsym(RTLD_NEXT, "memmove");
-    apis->strerror = (api_strerror_t)dlsym(RTLD_NEXT, "strerror");
-    apis->memmem = (api_memmem_t)dlsym(RTLD_NEXT, "memmem");
-    apis->memrchr = (api_memrchr_t)dlsym(RTLD_NEXT, "memrchr");
+/**
+ *  @brief  Lists the names, that took the longest to resolve, with their repetitions, failures, and the number
+ *          of calling threads, followed by their latency histograms and the threads blocked in the resolver.
+ */
+void libsee_print_resolution_stats(void) {
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = libsee_top_slots(libsee_resolved_names, sizeof(libsee_resolved_name), LIBSEE_MAX_RESOLVED_NAMES,
+        libsee_resolved_name_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_resolved_name const *slot = (libsee_resolved_name const *)top[reported];
+        size_t threads = 0, max_threads = sizeof(slot->threads) / sizeof(slot->threads[0]);
+        while (threads != max_threads && slot->threads[threads]) threads++;
+        if (reported == 0) syscall_print("slowest name lookups:\n", 22);
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->function_name);
+        stat_line[stat_line_length++] = ' ';
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->name);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 50);
+        stat_line_length += libsee_print_double((double)slot->nanoseconds / 1e6, ' ', 2, stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " ms, ");
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls, ");
+        stat_line_length += libsee_print_size(slot->calls - 1, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " repeated, ");
+        stat_line_length += libsee_print_size(slot->failures, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " failed, ");
+        stat_line_length += libsee_print_size(threads, ' ', stat_line + stat_line_length);
+        stat_line_length =
+            libsee_append_string(stat_line, stat_line_length, threads == max_threads ? "+ threads" : " threads");
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
 
-    apis->wcstombs = (api_wcstombs_t)dlsym(RTLD_NEXT, "wcstombs");
-    apis->wcswidth = (api_wcswidth_t)dlsym(RTLD_NEXT, "wcswidth");
-    apis->wcwidth = (api_wcwidth_t)dlsym(RTLD_NEXT, "wcwidth");
+    for (size_t i = 0; i != count; i++) {
+        libsee_resolved_name const *slot = (libsee_resolved_name const *)top[i];
+        char title[256];
+        size_t title_length = libsee_append_string(title, 0, slot->function_name);
+        title[title_length++] = ' ';
+        title_length = libsee_append_string(title, title_length, slot->name);
+        title_length = libsee_append_string(title, title_length, ", microseconds:");
+        libsee_print_histogram(title, &slot->microseconds);
+    }
+    libsee_print_keyed_stats("name resolution threads:", libsee_resolver_threads, LIBSEE_MAX_THREADS, 0);
+}
 
-    apis->malloc = (api_malloc_t)dlsym(RTLD_NEXT, "malloc");
-    apis->calloc = (api_calloc_t)dlsym(RTLD_NEXT, "calloc");
-    apis->realloc = (api_realloc_t)dlsym(RTLD_NEXT, "realloc");
-    apis->free = (api_free_t)dlsym(RTLD_NEXT, "free");
-    apis->aligned_alloc = (api_aligned_alloc_t)dlsym(RTLD_NEXT, "aligned_alloc");
+/**
+ *  @brief  Reports the per-clock costs of `clock_gettime`, flagging the clocks served by system calls
+ *          rather than the vDSO, and the distribution of sleep overshoots.
+ */
+void libsee_print_clock_stats(void) {
+    static char const *clock_names[LIBSEE_STATIC_CLOCKS + 1] = {
+        "CLOCK_REALTIME", "CLOCK_MONOTONIC", "CLOCK_PROCESS_CPUTIME_ID", "CLOCK_THREAD_CPUTIME_ID",
+        "CLOCK_MONOTONIC_RAW", "CLOCK_REALTIME_COARSE", "CLOCK_MONOTONIC_COARSE", "CLOCK_BOOTTIME",
+        "CLOCK_REALTIME_ALARM", "CLOCK_BOOTTIME_ALARM", "clock #10", "CLOCK_TAI", "dynamic clocks"};
+    // The vDSO only implements the clocks, that can be computed from the shared clock source page
+    static int const kernel_only[LIBSEE_STATIC_CLOCKS + 1] = {0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1};
+
+    int printed_header = 0;
+    for (size_t slot = 0; slot <= LIBSEE_STATIC_CLOCKS; slot++) {
+        size_t calls = 0, cycles = 0;
+        for (size_t t = 0; t < LIBSEE_MAX_THREADS; t++)
+            calls += libsee_clocks[t].calls[slot], cycles += libsee_clocks[t].cycles[slot];
+        if (calls == 0) continue;
+        if (!printed_header) syscall_print("clock_gettime per clock:\n", 25), printed_header = 1;
+
+        size_t cycles_per_call = cycles / calls;
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, clock_names[slot]);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 30);
+        stat_line_length += libsee_print_size(calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls, ");
+        stat_line_length += libsee_print_size(cycles_per_call, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles/call");
+        if (kernel_only[slot])
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", always a system call");
+        else if (cycles_per_call > LIBSEE_VDSO_MAX_CYCLES)
+            stat_line_length =
+                libsee_append_string(stat_line, stat_line_length, ", likely a system call: check the clock source");
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
 
-    apis->qsort = (api_qsort_t)dlsym(RTLD_NEXT, "qsort");
-    apis->bsearch = (api_bsearch_t)dlsym(RTLD_NEXT, "bsearch");
+    thread_local_counters const *calls = &libsee_thread_calls[0];
+    if (calls->named.nanosleep + calls->named.clock_nanosleep + calls->named.usleep + calls->named.sleep)
+        libsee_print_histogram("sleep overshoot, nanoseconds:", &libsee_oversleep_nanoseconds);
+}
 
-    apis->srand = (api_srand_t)dlsym(RTLD_NEXT, "srand");
-    apis->rand = (api_rand_t)dlsym(RTLD_NEXT, "rand");
+/**
+ *  @brief  Flags the random number generators with a process-wide state, that were called from many threads.
+ */
+void libsee_print_generator_hazards(void) {
+    static char const *shared_generators[] = {"rand", "random", "srand", "srandom", "drand48", "lrand48", "mrand48",
+                                              "srand48", "seed48", "lcong48"};
+    for (size_t g = 0; g < sizeof(shared_generators) / sizeof(shared_generators[0]); g++) {
+        size_t threads = 0, calls = 0;
+        for (size_t i = 0; i < LIBSEE_MAX_THREADS; i++) {
+            libsee_keyed_stats const *slot = &libsee_threads[i];
+            if (!slot->calls || libsee_apis.strcmp(slot->function_name, shared_generators[g]) != 0) continue;
+            threads++, calls += slot->calls;
+        }
+        if (threads < LIBSEE_CONTENDED_THREADS) continue;
 
-    apis->fopen = (api_fopen_t)dlsym(RTLD_NEXT, "fopen");
-    apis->freopen = (api_freopen_t)dlsym(RTLD_NEXT, "freopen");
-    apis->fclose = (api_fclose_t)dlsym(RTLD_NEXT, "fclose");
-    apis->fflush = (api_fflush_t)dlsym(RTLD_NEXT, "fflush");
-    apis->setbuf = (api_setbuf_t)dlsym(RTLD_NEXT, "setbuf");
-    apis->setvbuf = (api_setvbuf_t)dlsym(RTLD_NEXT, "setvbuf");
-    apis->fread = (api_fread_t)dlsym(RTLD_NEXT, "fread");
-    apis->fwrite = (api_fwrite_t)dlsym(RTLD_NEXT, "fwrite");
-    apis->fseek = (api_fseek_t)dlsym(RTLD_NEXT, "fseek");
-    apis->ftell = (api_ftell_t)dlsym(RTLD_NEXT, "ftell");
-    apis->fsetpos = (api_fsetpos_t)dlsym(RTLD_NEXT, "fsetpos");
-    apis->fgetpos = (api_fgetpos_t)dlsym(RTLD_NEXT, "fgetpos");
-    apis->rewind = (api_rewind_t)dlsym(RTLD_NEXT, "rewind");
-    apis->clearerr = (api_clearerr_t)dlsym(RTLD_NEXT, "clearerr");
-    apis->feof = (api_feof_t)dlsym(RTLD_NEXT, "feof");
-    apis->ferror = (api_ferror_t)dlsym(RTLD_NEXT, "ferror");
-    apis->perror = (api_perror_t)dlsym(RTLD_NEXT, "perror");
-    apis->scanf = (api_scanf_t)dlsym(RTLD_NEXT, "scanf");
-    apis->fscanf = (api_fscanf_t)dlsym(RTLD_NEXT, "fscanf");
-    apis->sscanf = (api_sscanf_t)dlsym(RTLD_NEXT, "sscanf");
-    apis->vscanf = (api_vscanf_t)dlsym(RTLD_NEXT, "vscanf");
-    apis->vfscanf = (api_vfscanf_t)dlsym(RTLD_NEXT, "vfscanf");
-    apis->vsscanf = (api_vsscanf_t)dlsym(RTLD_NEXT, "vsscanf");
-    apis->printf = (api_printf_t)dlsym(RTLD_NEXT, "printf");
-    apis->fprintf = (api_fprintf_t)dlsym(RTLD_NEXT, "fprintf");
-    apis->sprintf = (api_sprintf_t)dlsym(RTLD_NEXT, "sprintf");
-    apis->snprintf = (api_snprintf_t)dlsym(RTLD_NEXT, "snprintf");
-    apis->vprintf = (api_vprintf_t)dlsym(RTLD_NEXT, "vprintf");
-    apis->vfprintf = (api_vfprintf_t)dlsym(RTLD_NEXT, "vfprintf");
-    apis->vsprintf = (api_vsprintf_t)dlsym(RTLD_NEXT, "vsprintf");
-    apis->vsnprintf = (api_vsnprintf_t)dlsym(RTLD_NEXT, "vsnprintf");
+        int locked = g < 4; // The `rand` and `random` families take a lock, the `drand48` family races
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "scaling hazard: ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, shared_generators[g]);
+        stat_line_length = libsee_append_string(
+            stat_line, stat_line_length, locked ? " takes a global lock" : " shares a global state");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " and was called from ");
+        stat_line_length += libsee_print_size(threads, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " threads, ");
+        stat_line_length += libsee_print_size(calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls in total\n");
+        syscall_print(stat_line, stat_line_length);
+    }
+}
 
-    apis->difftime = (api_difftime_t)dlsym(RTLD_NEXT, "difftime");
-    apis->time = (api_time_t)dlsym(RTLD_NEXT, "time");
-    apis->clock = (api_clock_t)dlsym(RTLD_NEXT, "clock");
-    apis->timespec_get = (api_timespec_get_t)dlsym(RTLD_NEXT, "timespec_get");
-    apis->timespec_getres = (api_timespec_getres_t)dlsym(RTLD_NEXT, "timespec_getres");
-    apis->asctime = (api_asctime_t)dlsym(RTLD_NEXT, "asctime");
-    apis->ctime = (api_ctime_t)dlsym(RTLD_NEXT, "ctime");
-    apis->strftime = (api_strftime_t)dlsym(RTLD_NEXT, "strftime");
-    apis->wcsftime = (api_wcsftime_t)dlsym(RTLD_NEXT, "wcsftime");
-    apis->gmtime = (api_gmtime_t)dlsym(RTLD_NEXT, "gmtime");
-    apis->gmtime_r = (api_gmtime_r_t)dlsym(RTLD_NEXT, "gmtime_r");
-    apis->localtime = (api_localtime_t)dlsym(RTLD_NEXT, "localtime");
-    apis->localtime_r = (api_localtime_r_t)dlsym(RTLD_NEXT, "localtime_r");
-    apis->mktime = (api_mktime_t)dlsym(RTLD_NEXT, "mktime");
+/**
+ *  @brief  Reports the comparator invocations per tree and linear search, and the load of the hash tables.
+ */
+void libsee_print_search_stats(void) {
+    libsee_search_stats const *stats = &libsee_search;
+    thread_local_counters const *calls = &libsee_thread_calls[0];
+    if (calls->named.tsearch + calls->named.tfind + calls->named.tdelete)
+        libsee_print_histogram("tsearch, tfind, and tdelete comparisons per call:", &stats->tree_comparisons);
+    if (calls->named.lsearch + calls->named.lfind)
+        libsee_print_histogram("lsearch and lfind comparisons per call:", &stats->linear_comparisons);
+    if (calls->named.hsearch + calls->named.hsearch_r == 0) return;
+
+    syscall_print("hash tables:\n", 13);
+    char stat_line[256];
+    size_t stat_line_length = libsee_append_string(stat_line, 0, "  peak load factor,");
+    stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+    double peak_load = (double)stats->peak_load_per_mille / 1000.0;
+    stat_line_length += libsee_print_double(peak_load, ' ', 3, stat_line + stat_line_length);
+    if (stats->peak_load_per_mille > 800)
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, ", probe sequences degrade past 0.8");
+    stat_line[stat_line_length++] = '\n';
+    syscall_print(stat_line, stat_line_length);
+    libsee_print_stat("failed insertions into full tables", stats->hash_overflows);
+}
 
-#if defined(__STDC_LIB_EXT1__)
-    apis->strcpy_s = (api_strcpy_s_t)dlsym(RTLD_NEXT, "strcpy_s");
-    apis->strncpy_s = (api_strncpy_s_t)dlsym(RTLD_NEXT, "strncpy_s");
-    apis->strcat_s = (api_strcat_s_t)dlsym(RTLD_NEXT, "strcat_s");
-    apis->strncat_s = (api_strncat_s_t)dlsym(RTLD_NEXT, "strncat_s");
-    apis->strnlen_s = (api_strnlen_s_t)dlsym(RTLD_NEXT, "strnlen_s");
-    apis->strtok_s = (api_strtok_s_t)dlsym(RTLD_NEXT, "strtok_s");
-    apis->memset_s = (api_memset_s_t)dlsym(RTLD_NEXT, "memset_s");
-    apis->memcpy_s = (api_memcpy_s_t)dlsym(RTLD_NEXT, "memcpy_s");
-    apis->memmove_s = (api_memmove_s_t)dlsym(RTLD_NEXT, "memmove_s");
-    apis->strerror_s = (api_strerror_s_t)dlsym(RTLD_NEXT, "strerror_s");
-    apis->qsort_s = (api_qsort_s_t)dlsym(RTLD_NEXT, "qsort_s");
-    apis->bsearch_s = (api_bsearch_s_t)dlsym(RTLD_NEXT, "bsearch_s");
-    apis->asctime_s = (api_asctime_s_t)dlsym(RTLD_NEXT, "asctime_s");
-    apis->ctime_s = (api_ctime_s_t)dlsym(RTLD_NEXT, "ctime_s");
-    apis->gmtime_s = (api_gmtime_s_t)dlsym(RTLD_NEXT, "gmtime_s");
-    apis->localtime_s = (api_localtime_s_t)dlsym(RTLD_NEXT, "localtime_s");
-#endif
+size_t libsee_pattern_score(void const *slot) {
+    libsee_pattern_stats const *stats = (libsee_pattern_stats const *)slot;
+    return stats->cycles + stats->compile_cycles;
 }
 
-size_t libsee_print_size(size_t number, char thousands_separator, char *buffer) {
-    if (number == 0) {
-        buffer[0] = '0';
-        buffer[1] = '\0'; // Null terminate the string
-        return 1;
+/**
+ *  @brief  Lists the most expensive patterns, flagging the expressions compiled more than once.
+ */
+void libsee_print_pattern_stats(void) {
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count =
+        libsee_top_slots(libsee_patterns, sizeof(libsee_pattern_stats), LIBSEE_MAX_PATTERNS, libsee_pattern_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_pattern_stats const *slot = (libsee_pattern_stats const *)top[reported];
+        if (reported == 0) syscall_print("most expensive patterns:\n", 25);
+        char stat_line[LIBSEE_MAX_PATTERN_LENGTH + 256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->function_name);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " \"");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->pattern);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, "\",");
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 60);
+        if (slot->compiles) {
+            stat_line_length += libsee_print_size(slot->compiles, ' ', stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " compiles in ");
+            stat_line_length += libsee_print_size(slot->compile_cycles, ' ', stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles, ");
+        }
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls in ");
+        stat_line_length += libsee_print_size(slot->cycles, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " cycles, ");
+        if (slot->bytes) {
+            stat_line_length = libsee_append_cycles_per_byte(stat_line, stat_line_length, slot->cycles, slot->bytes);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+        }
+        stat_line_length += libsee_print_size(slot->hits, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " hits");
+        if (slot->jit_calls) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+            stat_line_length += libsee_print_size(slot->jit_calls, ' ', stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " with JIT");
+        }
+        if (slot->compiles > 1)
+            stat_line_length =
+                libsee_append_string(stat_line, stat_line_length, ", recompiled, reuse the compiled pattern");
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
     }
+}
 
-    size_t temp = number;
-    size_t digits = 0;
-    while (temp > 0) {
-        temp /= 10;
-        digits++;
-    }
+#if LIBSEE_PCRE2
 
-    // Calculate the total length including commas
-    size_t total_length = digits + (digits - 1) / 3;
+/**
+ *  @brief  Compares the number of PCRE2 match data blocks to the number of matches,
+ *          as the blocks are meant to be reused, and reports the patterns the JIT failed to compile.
+ */
+void libsee_print_pcre2_stats(void) {
+    thread_local_counters const *calls = &libsee_thread_calls[0];
+    size_t matches = calls->named.pcre2_match_8 + calls->named.pcre2_jit_match_8;
+    if (!matches && !libsee_pcre2.match_data_creations) return;
+    syscall_print("PCRE2 match data:\n", 18);
+    libsee_print_stat("blocks created", libsee_pcre2.match_data_creations);
+    libsee_print_stat("blocks released", libsee_pcre2.match_data_releases);
+    libsee_print_stat("matches", matches);
+    libsee_print_stat("failed JIT compilations", libsee_pcre2.jit_compile_failures);
+    if (libsee_pcre2.match_data_creations * 2 > matches && matches > 1)
+        syscall_print("  more than one block per two matches, reuse the block across matches\n", 70);
+}
 
-    temp = number;
-    size_t index = total_length; // Start filling the buffer from the end
-    buffer[index--] = '\0';      // Null-terminate the string
+#endif // LIBSEE_PCRE2
 
-    for (size_t i = 0; i < digits; i++) {
-        // Insert comma every three digits
-        if (i > 0 && i % 3 == 0) buffer[index--] = thousands_separator;
-        buffer[index--] = (temp % 10) + '0'; // Convert digit to character
-        temp /= 10;
-    }
+#if LIBSEE_BLAS
 
-    return total_length;
+size_t libsee_blas_shape_score(void const *slot) { return ((libsee_blas_shape const *)slot)->nanoseconds; }
+
+/**
+ *  @brief  Lists the BLAS and LAPACK shape classes taking the most time with their achieved throughput,
+ *          comparing it to the best class of the same routine, which is the closest estimate of the peak.
+ */
+void libsee_print_blas_stats(void) {
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = libsee_top_slots(libsee_blas_shapes, sizeof(libsee_blas_shape), LIBSEE_MAX_BLAS_SHAPES,
+        libsee_blas_shape_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_blas_shape const *slot = (libsee_blas_shape const *)top[reported];
+        double gigaflops = slot->nanoseconds ? (double)slot->flops / (double)slot->nanoseconds : 0;
+        double best_gigaflops = gigaflops;
+        for (size_t i = 0; i < LIBSEE_MAX_BLAS_SHAPES; i++) {
+            libsee_blas_shape const *other = &libsee_blas_shapes[i];
+            if (!other->calls || !other->nanoseconds || libsee_apis.strcmp(other->routine, slot->routine) != 0)
+                continue;
+            double other_gigaflops = (double)other->flops / (double)other->nanoseconds;
+            if (other_gigaflops > best_gigaflops) best_gigaflops = other_gigaflops;
+        }
+
+        if (reported == 0) syscall_print("BLAS and LAPACK shapes, rounded up to powers of two:\n", 53);
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->routine);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " up to ");
+        stat_line_length += libsee_print_size(1ull << slot->rows_log2, 0, stat_line + stat_line_length);
+        // Vector routines have one dimension, the multiplications and the solvers with many right-hand sides three
+        char const *kind = slot->routine + 1;
+        int is_vector = libsee_apis.strcmp(kind, "axpy") == 0 || libsee_apis.strcmp(kind, "dot") == 0;
+        int has_depth = libsee_apis.strcmp(kind, "gemm") == 0 || libsee_apis.strcmp(kind, "gesv") == 0;
+        if (!is_vector) {
+            stat_line[stat_line_length++] = 'x';
+            stat_line_length += libsee_print_size(1ull << slot->columns_log2, 0, stat_line + stat_line_length);
+        }
+        if (has_depth) {
+            stat_line[stat_line_length++] = 'x';
+            stat_line_length += libsee_print_size(1ull << slot->depth_log2, 0, stat_line + stat_line_length);
+        }
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls, ");
+        double microseconds_per_call = (double)slot->nanoseconds / 1000.0 / (double)slot->calls;
+        stat_line_length += libsee_print_double(microseconds_per_call, ' ', 2, stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " us/call");
+        if (slot->flops) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+            stat_line_length += libsee_print_double(gigaflops, ' ', 2, stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " GFLOP/s, ");
+            double flops_per_cycle = slot->cycles ? (double)slot->flops / (double)slot->cycles : 0;
+            stat_line_length += libsee_print_double(flops_per_cycle, ' ', 2, stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " FLOP/cycle");
+        }
+        if (gigaflops * 10 < best_gigaflops) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+            size_t percent = (size_t)(gigaflops * 100 / best_gigaflops);
+            stat_line_length += libsee_print_size(percent, 0, stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, "% of the best ");
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->routine);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " shape, consider batching");
+        }
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
+    }
 }
 
-size_t libsee_print_double(double number, char thousands_separator, size_t decimal_points, char *buffer) {
-    // Handle negative numbers
-    if (number < 0) {
-        *buffer++ = '-';
-        number = -number; // Make the number positive for formatting
+/**
+ *  @brief  Lists the LAPACK workspace queries, flagging the ones repeated for identical arguments,
+ *          as the optimal workspace size only depends on them and can be computed once.
+ */
+void libsee_print_workspace_queries(void) {
+    int printed_header = 0;
+    for (size_t i = 0; i < LIBSEE_MAX_BLAS_SHAPES; i++) {
+        libsee_workspace_query const *slot = &libsee_workspace_queries[i];
+        if (!libsee_slot_is_published(__atomic_load_n(&slot->key, __ATOMIC_ACQUIRE)) || !slot->calls) continue;
+        if (!printed_header) syscall_print("LAPACK workspace queries:\n", 26), printed_header = 1;
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->routine);
+        stat_line[stat_line_length++] = ' ';
+        stat_line_length += libsee_print_size((size_t)slot->rows, 0, stat_line + stat_line_length);
+        stat_line[stat_line_length++] = 'x';
+        stat_line_length += libsee_print_size((size_t)slot->columns, 0, stat_line + stat_line_length);
+        if (slot->job) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " jobz=");
+            stat_line[stat_line_length++] = slot->job;
+        }
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 40);
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " queries");
+        if (slot->calls > 1)
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", repeated, cache the optimal lwork");
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
     }
+}
 
-    // Split number into integer and fractional parts
-    double integer_part = (size_t)number;
-    double fractional_part = number - integer_part;
+#endif // LIBSEE_BLAS
 
-    // Convert integer part to string with thousands separator
-    size_t integer_length = libsee_print_size((size_t)integer_part, thousands_separator, buffer);
+#if LIBSEE_ZLIB
 
-    // Add decimal point
-    buffer[integer_length] = '.';
-    size_t total_length = integer_length + 1; // +1 for the decimal point
+size_t libsee_zlib_site_score(void const *slot) { return ((libsee_zlib_site const *)slot)->nanoseconds; }
 
-    // Handle fractional part
-    for (size_t i = 0; i < decimal_points; i++) {
-        fractional_part *= 10;                   // Shift fractional part to the left
-        int digit = (int)(fractional_part) % 10; // Get next digit
-        buffer[total_length++] = '0' + digit;    // Convert digit to character and store
+/**
+ *  @brief  Lists the zlib call sites taking the most time with their compression ratios and throughput,
+ *          and compares the number of streams to their resets and the bytes passed through them.
+ */
+void libsee_print_zlib_stats(void) {
+    void const *top[LIBSEE_MAX_REPORTED_CALL_SITES];
+    size_t count = libsee_top_slots(libsee_zlib_sites, sizeof(libsee_zlib_site), LIBSEE_MAX_ZLIB_SITES,
+        libsee_zlib_site_score, top);
+    for (size_t reported = 0; reported != count; reported++) {
+        libsee_zlib_site const *slot = (libsee_zlib_site const *)top[reported];
+        if (reported == 0) syscall_print("zlib call sites:\n", 17);
+        char stat_line[256];
+        size_t stat_line_length = libsee_append_string(stat_line, 0, "  ");
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, slot->function_name);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 20);
+        stat_line_length = libsee_append_call_site(stat_line, stat_line_length, slot->origin);
+        stat_line[stat_line_length++] = ',';
+        stat_line_length = libsee_pad_buffer(stat_line, stat_line_length, 70);
+        stat_line_length += libsee_print_size(slot->calls, ' ', stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " calls, ");
+        double microseconds_per_call = (double)slot->nanoseconds / 1000.0 / (double)slot->calls;
+        stat_line_length += libsee_print_double(microseconds_per_call, ' ', 2, stat_line + stat_line_length);
+        stat_line_length = libsee_append_string(stat_line, stat_line_length, " us/call");
+        if (slot->uncompressed_bytes && slot->nanoseconds) {
+            // Throughput is measured on the uncompressed side, both for compression and decompression
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ");
+            double megabytes_per_second = (double)slot->uncompressed_bytes * 1000.0 / (double)slot->nanoseconds;
+            stat_line_length += libsee_print_double(megabytes_per_second, ' ', 2, stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " MB/s, ");
+            stat_line_length += libsee_print_size(slot->uncompressed_bytes, ' ', stat_line + stat_line_length);
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, " bytes");
+        }
+        if (slot->uncompressed_bytes && slot->compressed_bytes) {
+            stat_line_length = libsee_append_string(stat_line, stat_line_length, ", ratio ");
+            double ratio = (double)slot->uncompressed_bytes / (double)slot->compressed_bytes;
+            stat_line_length += libsee_print_double(ratio, ' ', 2, stat_line + stat_line_length);
+        }
+        stat_line[stat_line_length++] = '\n';
+        syscall_print(stat_line, stat_line_length);
     }
 
-    // Null-terminate the string
-    buffer[total_length] = '\0';
-
-    return total_length; // Return length of the string
+    if (!libsee_zlib.deflate_streams && !libsee_zlib.inflate_streams) return;
+    syscall_print("zlib streams:\n", 14);
+    libsee_print_stat("deflate streams", libsee_zlib.deflate_streams);
+    libsee_print_stat("deflate resets", libsee_zlib.deflate_resets);
+    libsee_print_stat("inflate streams", libsee_zlib.inflate_streams);
+    libsee_print_stat("inflate resets", libsee_zlib.inflate_resets);
+    // With the default settings, a deflate stream allocates about 256 KB, and an inflate one about 40 KB
+    if (libsee_zlib.deflate_streams > 1 && libsee_zlib.deflated_bytes / libsee_zlib.deflate_streams < 256 * 1024)
+        syscall_print("  deflate streams are short-lived, keep one per thread and call deflateReset\n", 77);
+    if (libsee_zlib.inflate_streams > 1 && libsee_zlib.inflated_bytes / libsee_zlib.inflate_streams < 32 * 1024)
+        syscall_print("  inflate streams are short-lived, keep one per thread and call inflateReset\n", 77);
 }
 
-size_t libsee_pad_buffer(char *buffer, size_t current_length, size_t target_length) {
-    while (current_length < target_length) { buffer[current_length++] = ' '; }
-    buffer[current_length] = '\0'; // Null-terminate the padded string
-    return target_length;
-}
+#endif // LIBSEE_ZLIB
 
 void libsee_finalize(void) {
     reopen_stdout();
@@ -1385,33 +8301,102 @@ void libsee_finalize(void) {
         for (size_t j = 0; j < counters_per_thread; j++) {
             libsee_thread_cycles[0].indexed[j] += libsee_thread_cycles[t].indexed[j];
             libsee_thread_calls[0].indexed[j] += libsee_thread_calls[t].indexed[j];
+            libsee_thread_bytes[0].indexed[j] += libsee_thread_bytes[t].indexed[j];
         }
     }
 
-    // Create an on-stack array of all of those counters, populate them, and sort by the most called functions.
-    libsee_name_stats named_stats[] = {// Strings
+    // Create a static array of all of those counters, populate them, and sort by the most called functions.
+    // Initializing an on-stack array this large is compiled into a `memset`, which we intercept ourselves.
+    static libsee_name_stats named_stats[] = {// Strings
         {"strcpy"}, {"strcpy_s"}, {"strncpy"}, {"strncpy_s"}, {"strcat"}, {"strcat_s"}, {"strncat"}, {"strncat_s"},
         {"strxfrm"}, {"strlen"}, {"strnlen_s"}, {"strcmp"}, {"strncmp"}, {"strcoll"}, {"strchr"}, {"strrchr"},
         {"strspn"}, {"strcspn"}, {"strpbrk"}, {"strstr"}, {"strtok"}, {"strtok_s"}, {"memchr"}, {"memcmp"}, {"memset"},
         {"memset_s"}, {"memcpy"}, {"memcpy_s"}, {"memmove"}, {"memmove_s"}, {"strerror"}, {"strerror_s"}, {"memmem"},
         {"memrchr"},
+        // Wide character widths and narrowing
+        {"wcstombs"}, {"wcswidth"}, {"wcwidth"},
         // Wide strings
-        {"wcstombs"}, {"mbstowcs"}, {"mbrtowc"},
+        {"wcslen"}, {"wcsnlen"}, {"wcscmp"}, {"wcsncmp"}, {"wcscpy"}, {"wcsncpy"}, {"wcscat"}, {"wcschr"}, {"wcsrchr"},
+        {"wcsstr"}, {"wcstok"}, {"wmemcpy"}, {"wmemmove"}, {"wmemset"}, {"wmemcmp"}, {"wmemchr"}, {"wcscoll"},
+        {"wcsxfrm"},
+        // Multibyte conversions
+        {"mbrtowc"}, {"mbstowcs"}, {"wcrtomb"}, {"wcsrtombs"}, {"mbrlen"}, {"mbsrtowcs"}, {"btowc"}, {"iconv"},
         // Heap
         {"malloc"}, {"calloc"}, {"realloc"}, {"free"}, {"aligned_alloc"},
         // Algorithms
         {"qsort"}, {"qsort_s"}, {"bsearch"}, {"bsearch_s"},
+        // Search tables
+        {"hcreate"}, {"hsearch"}, {"hdestroy"}, {"hcreate_r"}, {"hsearch_r"}, {"hdestroy_r"}, {"tsearch"}, {"tfind"},
+        {"tdelete"}, {"twalk"}, {"lsearch"}, {"lfind"},
+        // Pattern matching
+        {"regcomp"}, {"regexec"}, {"regerror"}, {"regfree"}, {"fnmatch"}, {"glob"}, {"globfree"}, {"wordexp"},
+        {"wordfree"},
+        // PCRE2, only intercepted by the optional module
+        {"pcre2_compile_8"}, {"pcre2_code_free_8"}, {"pcre2_jit_compile_8"}, {"pcre2_match_8"}, {"pcre2_jit_match_8"},
+        {"pcre2_match_data_create_8"}, {"pcre2_match_data_create_from_pattern_8"}, {"pcre2_match_data_free_8"},
+        // BLAS, only intercepted by the optional module
+        {"cblas_sgemm"}, {"cblas_dgemm"}, {"cblas_sgemv"}, {"cblas_dgemv"}, {"cblas_saxpy"}, {"cblas_daxpy"},
+        {"cblas_sdot"}, {"cblas_ddot"}, {"sgemm_"}, {"dgemm_"}, {"sgemv_"}, {"dgemv_"}, {"saxpy_"}, {"daxpy_"},
+        {"sdot_"}, {"ddot_"},
+        // LAPACK, only intercepted by the optional module
+        {"sgesv_"}, {"dgesv_"}, {"sgetrf_"}, {"dgetrf_"}, {"spotrf_"}, {"dpotrf_"}, {"sgeqrf_"}, {"dgeqrf_"},
+        {"ssyev_"}, {"dsyev_"}, {"sgesdd_"}, {"dgesdd_"},
+        // zlib
+        {"deflateInit_"}, {"deflateInit2_"}, {"deflate"}, {"deflateReset"}, {"deflateEnd"}, {"inflateInit_"},
+        {"inflateInit2_"}, {"inflate"}, {"inflateReset"}, {"inflateEnd"}, {"compress2"}, {"uncompress"}, {"crc32"},
+        {"adler32"},
         // Numerics
         {"srand"}, {"rand"},
+        // Random number generators
+        {"random"}, {"srandom"}, {"rand_r"}, {"random_r"}, {"drand48"}, {"erand48"}, {"lrand48"}, {"nrand48"},
+        {"mrand48"}, {"jrand48"}, {"srand48"}, {"seed48"}, {"lcong48"}, {"arc4random"}, {"arc4random_buf"},
+        {"arc4random_uniform"}, {"getrandom"},
+        // Math
+        {"exp"}, {"expf"}, {"expl"}, {"log"}, {"logf"}, {"logl"}, {"pow"}, {"powf"}, {"powl"}, {"sin"}, {"sinf"},
+        {"sinl"}, {"cos"}, {"cosf"}, {"cosl"}, {"sqrt"}, {"sqrtf"}, {"sqrtl"}, {"fmod"}, {"fmodf"}, {"fmodl"}, {"erf"},
+        {"erff"}, {"erfl"}, {"lgamma"}, {"lgammaf"}, {"lgammal"},
+        // Numeric conversions
+        {"strtol"}, {"strtoll"}, {"strtoul"}, {"strtoull"}, {"strtoimax"}, {"strtoumax"}, {"strtof"}, {"strtod"},
+        {"strtold"}, {"strtol_l"}, {"strtoll_l"}, {"strtoul_l"}, {"strtoull_l"}, {"strtof_l"}, {"strtod_l"},
+        {"strtold_l"}, {"atoi"}, {"atol"}, {"atoll"}, {"atof"}, {"strfromf"}, {"strfromd"}, {"strfroml"},
+        // Localization
+        {"setlocale"}, {"localeconv"}, {"newlocale"}, {"uselocale"}, {"duplocale"}, {"freelocale"}, {"nl_langinfo"},
         // I/O
         {"fopen"}, {"freopen"}, {"fclose"}, {"fflush"}, {"setbuf"}, {"setvbuf"}, {"fread"}, {"fwrite"}, {"fseek"},
-        {"ftell"}, {"fsetpos"}, {"fgetpos"}, {"rewind"}, {"clearerr"}, {"feof"}, {"ferror"}, {"perror"}, {"scanf"},
-        {"fscanf"}, {"sscanf"}, {"vscanf"}, {"vfscanf"}, {"vsscanf"}, {"printf"}, {"fprintf"}, {"sprintf"},
-        {"snprintf"}, {"vprintf"}, {"vfprintf"}, {"vsprintf"}, {"vsnprintf"},
+        {"ftell"}, {"fsetpos"}, {"fgetpos"}, {"rewind"}, {"clearerr"}, {"feof"}, {"ferror"}, {"perror"},
+        // Character I/O
+        {"fgetc"}, {"getc"}, {"getchar"}, {"fgets"}, {"ungetc"}, {"getline"}, {"getdelim"}, {"fputc"}, {"putc"},
+        {"putchar"}, {"fputs"}, {"puts"}, {"fgetc_unlocked"}, {"getc_unlocked"}, {"getchar_unlocked"},
+        {"fgets_unlocked"}, {"fputc_unlocked"}, {"putc_unlocked"}, {"putchar_unlocked"}, {"fputs_unlocked"},
+        {"scanf"}, {"fscanf"}, {"sscanf"}, {"vscanf"}, {"vfscanf"}, {"vsscanf"}, {"printf"}, {"fprintf"},
+        {"sprintf"}, {"snprintf"}, {"vprintf"}, {"vfprintf"}, {"vsprintf"}, {"vsnprintf"},
+        // Wide I/O
+        {"fgetwc"}, {"getwc"}, {"fgetws"}, {"fputwc"}, {"putwc"}, {"fputws"}, {"fwide"}, {"vfwscanf"}, {"vswscanf"},
+        {"vwprintf"}, {"vfwprintf"}, {"vswprintf"},
         // Time
         {"difftime"}, {"time"}, {"clock"}, {"timespec_get"}, {"timespec_getres"}, {"asctime"}, {"asctime_s"}, {"ctime"},
         {"ctime_s"}, {"strftime"}, {"wcsftime"}, {"gmtime"}, {"gmtime_r"}, {"gmtime_s"}, {"localtime"}, {"localtime_r"},
-        {"localtime_s"}, {"mktime"}};
+        {"localtime_s"}, {"mktime"},
+        // Clocks and sleeps
+        {"clock_gettime"}, {"gettimeofday"}, {"nanosleep"}, {"clock_nanosleep"}, {"usleep"}, {"sleep"},
+        // Networking
+        {"socket"}, {"socketpair"}, {"accept"}, {"accept4"}, {"connect"}, {"send"}, {"sendto"}, {"sendmsg"},
+        {"sendmmsg"}, {"recv"}, {"recvfrom"}, {"recvmsg"}, {"recvmmsg"}, {"poll"}, {"select"}, {"epoll_wait"},
+        {"epoll_ctl"},
+        // Processes
+        {"fork"}, {"posix_spawn"}, {"posix_spawnp"}, {"execve"}, {"execv"}, {"execvp"}, {"execvpe"}, {"system"},
+        {"popen"}, {"pclose"}, {"wait"}, {"waitpid"}, {"wait4"},
+        // Dynamic loading
+        {"dlopen"}, {"dlmopen"}, {"dlclose"}, {"__libc_start_main"},
+        // Filesystem metadata
+        {"stat"}, {"lstat"}, {"fstat"}, {"fstatat"}, {"statx"}, {"access"}, {"faccessat"}, {"opendir"}, {"readdir"},
+        {"closedir"}, {"realpath"}, {"getcwd"}, {"unlink"}, {"rename"}, {"mkdir"}, {"stat64"}, {"lstat64"}, {"fstat64"},
+        {"fstatat64"}, {"readdir64"},
+        // Environment
+        {"getenv"}, {"secure_getenv"}, {"setenv"}, {"unsetenv"}, {"putenv"}, {"clearenv"},
+        // Name resolution
+        {"getaddrinfo"}, {"freeaddrinfo"}, {"getnameinfo"}, {"gethostbyname"}, {"gethostbyname_r"}, {"getservbyname"},
+        {"getpwnam"}, {"getpwuid"}, {"getgrnam"}};
 
     COMPILE_TIME_ASSERT(sizeof(real_apis) / sizeof(void *) == sizeof(named_stats) / sizeof(libsee_name_stats),
         number_of_counters_must_be_equal);
@@ -1420,6 +8405,7 @@ void libsee_finalize(void) {
     for (size_t i = 0; i < counters_per_thread; i++) {
         named_stats[i].total_calls = libsee_thread_calls[0].indexed[i];
         named_stats[i].total_cycles = libsee_thread_cycles[0].indexed[i];
+        named_stats[i].total_bytes = libsee_thread_bytes[0].indexed[i];
     }
 
     // Sort the `named_stats` array with the simplest algorithm possible,
@@ -1441,10 +8427,12 @@ void libsee_finalize(void) {
     syscall_print("LibSee function usage report (in descending order of CPU cycles):\n", 52);
 #endif
     syscall_print("----------------------------------LIBSEE----------------------------------------\n", 81);
-    size_t column_widths[] = {20, 40, 15, 15};
+    size_t column_widths[] = {20, 40, 15, 15, 20};
 
     // Print headers
-    syscall_print("function,           cycles,                                 calls,         share\n", 81);
+    syscall_print("function,           cycles,                                 calls,         share,         "
+                  "bytes,              cycles/byte\n",
+        122);
 
     // Print the sorted stats
     for (size_t i = 0; i < counters_per_thread; i++) {
@@ -1453,6 +8441,7 @@ void libsee_finalize(void) {
         char const *function_name = named_stats[i].function_name;
         size_t total_cycles = named_stats[i].total_cycles;
         size_t total_calls = named_stats[i].total_calls;
+        size_t total_bytes = named_stats[i].total_bytes;
         double percent_cycles = (double)total_cycles * 100.0 / (double)cycles_across_threads;
         if (total_cycles == 0) { continue; } // Skip functions that were never called.
 
@@ -1476,9 +8465,20 @@ void libsee_finalize(void) {
         // Convert and append percent_cycles with specified decimal points (e.g., 2) and padding
         stat_line_length += libsee_print_double(percent_cycles, ' ', 2, stat_line + stat_line_length);
 
+        // Only some functions know how many bytes they've processed, the rest end with the share column.
+        if (total_bytes) {
+            stat_line[stat_line_length++] = ',';
+            stat_line_length = libsee_pad_buffer(stat_line, stat_line_length,
+                column_widths[0] + column_widths[1] + column_widths[2] + column_widths[3]);
+            stat_line_length += libsee_print_size(total_bytes, ' ', stat_line + stat_line_length);
+            stat_line[stat_line_length++] = ',';
+            stat_line_length = libsee_pad_buffer(stat_line, stat_line_length,
+                column_widths[0] + column_widths[1] + column_widths[2] + column_widths[3] + column_widths[4]);
+            double cycles_per_byte = (double)total_cycles / (double)total_bytes;
+            stat_line_length += libsee_print_double(cycles_per_byte, ' ', 2, stat_line + stat_line_length);
+        }
+
         // We don't need padding at the end, just the newline.
-        // stat_line_length = libsee_pad_buffer(stat_line, stat_line_length,
-        //     column_widths[0] + column_widths[1] + column_widths[2] + column_widths[3]);
         stat_line[stat_line_length++] = '\n';
 
         // Ensure the line is null-terminated.
@@ -1486,6 +8486,43 @@ void libsee_finalize(void) {
         syscall_print(stat_line, stat_line_length);
     }
 
+    libsee_print_sort_stats();
+    libsee_print_search_stats();
+    libsee_print_pattern_stats();
+#if LIBSEE_PCRE2
+    libsee_print_pcre2_stats();
+#endif
+#if LIBSEE_BLAS
+    libsee_print_blas_stats();
+    libsee_print_workspace_queries();
+#endif
+#if LIBSEE_ZLIB
+    libsee_print_zlib_stats();
+#endif
+    libsee_print_math_stats();
+    libsee_print_multibyte_stats();
+    libsee_print_wide_stdio_stats();
+    libsee_print_stream_locking_stats();
+    libsee_print_stream_buffering_stats();
+    libsee_print_path_stats();
+    libsee_print_access_patterns();
+    libsee_print_path_prefix_stats();
+    libsee_print_environment_stats();
+    libsee_print_resolution_stats();
+    libsee_print_socket_stats();
+    libsee_print_process_stats();
+    libsee_print_dynamic_loading_stats();
+    libsee_print_clock_stats();
+    libsee_print_rate_hazard("setlocale", &libsee_setlocale_rate, LIBSEE_LOCALE_CALLS_PER_SECOND);
+    libsee_print_rate_hazard("localeconv", &libsee_localeconv_rate, LIBSEE_LOCALE_CALLS_PER_SECOND);
+    libsee_print_generator_hazards();
+    libsee_print_keyed_stats("most expensive call sites:", libsee_call_sites, LIBSEE_MAX_CALL_SITES, 1);
+    libsee_print_keyed_stats("most expensive threads:", libsee_threads, LIBSEE_MAX_THREADS, 0);
+    if (libsee_dropped_updates) {
+        syscall_print("full tables:\n", 13);
+        libsee_print_stat("dropped updates", libsee_dropped_updates);
+    }
+
     syscall_print("----------------------------------LIBSEE----------------------------------------\n", 81);
     close_stdout();
 }
@@ -1504,12 +8541,26 @@ void libsee_finalize(void) {
 // functions that are called when the shared library is unloaded... but the problem is that
 // STDIN and STDOUT descriptors are closed before the destructor is called... So I use inline Asm
 // to reopen them and close again.
+//
+// Not every symbol is guaranteed to be present, as some libraries may only be loaded later.
+// A failed `dlsym` allocates the error message with `malloc`, re-entering LibSee before the
+// initialization is over, so the initializing thread proceeds with the symbols resolved so far,
+// while the other threads wait for it to finish, rather than calling the unresolved pointers.
 void libsee_initialize_if_not(void) {
-    static int initialized = 0;
-    if (__builtin_expect(initialized == 0, 0)) {
+    enum { not_started = 0, in_progress = 1, done = 2 };
+    static int state = not_started;
+    static __thread int initializing = 0;
+    if (__builtin_expect(__atomic_load_n(&state, __ATOMIC_ACQUIRE) == done, 1)) return;
+    if (initializing) return;
+    int expected = not_started;
+    if (__atomic_compare_exchange_n(&state, &expected, in_progress, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        initializing = 1;
         libsee_initialize();
-        initialized = 1;
+        initializing = 0;
+        __atomic_store_n(&state, done, __ATOMIC_RELEASE);
+        return;
     }
+    while (__atomic_load_n(&state, __ATOMIC_ACQUIRE) != done) syscall(SYS_sched_yield);
 }
 
 __attribute__((constructor)) void libsee_initialize_gcc(void) {}
@@ -0,0 +1,1034 @@
+/**
+ *  @file   libsee_test.c
+ *  @brief  Tests for LibSee, that run every scenario in a child process with LibSee preloaded,
+ *          and check the printed report for the statistics, that the scenario should have produced.
+ *
+ *  Without arguments, all scenarios are run and checked. With a scenario name, only that scenario
+ *  is executed in the current process, which is how the children are started.
+ */
+#define _GNU_SOURCE
+#include <arpa/inet.h>  // `htonl`
+#include <dirent.h>     // `opendir`, `readdir`
+#include <dlfcn.h>      // `dlopen`
+#include <locale.h>     // `setlocale`, `localeconv`
+#include <math.h>       // `sin`, `exp`, `isfinite`
+#include <netdb.h>      // `getaddrinfo`, `gethostbyname`
+#include <netinet/in.h> // `struct sockaddr_in`
+#include <poll.h>       // `poll`
+#include <pthread.h>    // `pthread_create`, `pthread_join`
+#include <regex.h>      // `regcomp`, `regexec`
+#include <search.h>     // `hsearch`, `tsearch`, `lfind`
+#include <spawn.h>      // `posix_spawn`
+#include <stdio.h>      // `fprintf`
+#include <stdlib.h>     // `exit`, `setenv`
+#include <string.h>     // `strstr`, `strcmp`
+#include <sys/epoll.h>  // `epoll_create1`, `epoll_ctl`, `epoll_wait`
+#include <sys/select.h> // `select`
+#include <sys/socket.h> // `socketpair`, `sendmmsg`, `recvmmsg`
+#include <sys/stat.h>   // `stat`
+#include <sys/wait.h>   // `waitpid`
+#include <time.h>       // `clock_gettime`, `nanosleep`
+#include <unistd.h>     // `fork`, `execl`, `pipe`
+#include <wchar.h>      // `mbrtowc`, `wcscmp`, `wcslen`
+
+#if LIBSEE_TEST_PCRE2
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h> // `pcre2_compile`, `pcre2_match`
+#endif
+
+#if LIBSEE_TEST_ZLIB
+#include <zlib.h> // `compress2`, `uncompress`, `deflateInit`
+/*
+ *  zlib isn't linked, but opened in the middle of the scenario, so the wrappers have to find it after the start.
+ *  Until then, these references resolve to the wrappers exported by the preloaded LibSee.
+ */
+#pragma weak compress2
+#pragma weak uncompress
+#pragma weak deflateInit_
+#pragma weak deflate
+#pragma weak deflateEnd
+#endif
+
+#if !defined(LIBSEE_LIBRARY_PATH)
+#define LIBSEE_LIBRARY_PATH "./libsee.so"
+#endif
+
+#define LIBSEE_TEST_MAX_REPORT (4 * 1024 * 1024)
+
+/*
+ *  The scenarios stop at the first unexpected result, as their reports would be meaningless afterwards.
+ */
+#define test_require(condition)                                                                  \
+    do {                                                                                         \
+        if (!(condition)) {                                                                      \
+            fprintf(stderr, "%s:%d: requirement failed: %s\n", __FILE__, __LINE__, #condition); \
+            exit(1);                                                                             \
+        }                                                                                        \
+    } while (0)
+
+/**
+ *  @brief  Counts the report lines containing both substrings, within the section with the given title,
+ *          that lasts until the next line, that isn't indented. With a NULL title the whole report is searched.
+ */
+size_t test_report_count(char const *report, char const *title, char const *first, char const *second) {
+    char const *line = report;
+    if (title) {
+        line = strstr(report, title);
+        if (!line) return 0;
+        line = strchr(line, '\n');
+        if (!line) return 0;
+        line++;
+    }
+    size_t count = 0;
+    for (; *line; line++) {
+        char const *end = strchr(line, '\n');
+        if (!end) end = line + strlen(line);
+        if (title && line[0] != ' ') break;
+        char copy[1024];
+        size_t length = (size_t)(end - line) < sizeof(copy) ? (size_t)(end - line) : sizeof(copy) - 1;
+        memcpy(copy, line, length);
+        copy[length] = 0;
+        count += strstr(copy, first) && (!second || strstr(copy, second));
+        if (!*end) break;
+        line = end;
+    }
+    return count;
+}
+
+int test_report_has(char const *report, char const *title, char const *first, char const *second) {
+    return test_report_count(report, title, first, second) != 0;
+}
+
+#pragma region Sockets
+
+/**
+ *  @brief  Streams fixed-size messages over a Unix socket pair, batches datagrams with `sendmmsg` and `recvmmsg`,
+ *          and wakes up an epoll loop for a single event at a time.
+ */
+void test_socketpair_run(void) {
+    int stream[2], datagram[2];
+    test_require(socketpair(AF_UNIX, SOCK_STREAM, 0, stream) == 0);
+    test_require(socketpair(AF_UNIX, SOCK_DGRAM, 0, datagram) == 0);
+
+    char buffer[64] = {0};
+    for (int i = 0; i != 100; i++) {
+        test_require(send(stream[0], buffer, sizeof(buffer), 0) == sizeof(buffer));
+        test_require(recv(stream[1], buffer, sizeof(buffer), MSG_WAITALL) == sizeof(buffer));
+    }
+
+    char payloads[4][16] = {{0}};
+    struct iovec vectors[4];
+    struct mmsghdr messages[4];
+    for (int batch = 0; batch != 8; batch++) {
+        memset(messages, 0, sizeof(messages));
+        for (int i = 0; i != 4; i++) {
+            vectors[i].iov_base = payloads[i], vectors[i].iov_len = sizeof(payloads[i]);
+            messages[i].msg_hdr.msg_iov = &vectors[i], messages[i].msg_hdr.msg_iovlen = 1;
+        }
+        test_require(sendmmsg(datagram[0], messages, 4, 0) == 4);
+        test_require(recvmmsg(datagram[1], messages, 4, 0, NULL) == 4);
+    }
+
+    int epoll_fd = epoll_create1(0);
+    test_require(epoll_fd >= 0);
+    struct epoll_event interest = {0}, events[8];
+    interest.events = EPOLLIN, interest.data.fd = stream[1];
+    test_require(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, stream[1], &interest) == 0);
+    for (int i = 0; i != 10; i++) {
+        test_require(send(stream[0], buffer, 1, 0) == 1);
+        test_require(epoll_wait(epoll_fd, events, 8, 1000) == 1);
+        test_require(recv(stream[1], buffer, 1, 0) == 1);
+    }
+    close(epoll_fd);
+    close(stream[0]), close(stream[1]), close(datagram[0]), close(datagram[1]);
+}
+
+int test_socketpair_check(char const *report) {
+    // The first loop and the epoll loop share the stream sockets
+    return test_report_has(report, "busiest sockets:", "6 410 bytes in 110 sends", NULL) &&
+           test_report_has(report, "busiest sockets:", "6 410 bytes in 110 receives", NULL) &&
+           test_report_has(report, "busiest sockets:", "512 bytes in 32 sends", NULL) &&
+           test_report_has(report, "busiest sockets:", "512 bytes in 32 receives", NULL) &&
+           test_report_has(report, "socket bytes per sent message:", "[64, 127]", " 100") &&
+           test_report_has(report, "sendmmsg messages per call:", "[4, 7]", " 8") &&
+           test_report_has(report, "recvmmsg messages per call:", "[4, 7]", " 8") &&
+           test_report_has(report, "epoll_wait events per wakeup:", "[1, 1]", " 10");
+}
+
+/**
+ *  @brief  Connects to a listening socket over the loopback interface, and waits for the transfers
+ *          with `poll` and `select`, before receiving them on the accepted socket.
+ */
+void test_loopback_run(void) {
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    test_require(listener >= 0);
+    struct sockaddr_in address = {0};
+    address.sin_family = AF_INET, address.sin_addr.s_addr = htonl(INADDR_LOOPBACK), address.sin_port = 0;
+    socklen_t address_length = sizeof(address);
+    test_require(bind(listener, (struct sockaddr *)&address, sizeof(address)) == 0);
+    test_require(listen(listener, 1) == 0);
+    test_require(getsockname(listener, (struct sockaddr *)&address, &address_length) == 0);
+
+    int client = socket(AF_INET, SOCK_STREAM, 0);
+    test_require(client >= 0);
+    test_require(connect(client, (struct sockaddr *)&address, sizeof(address)) == 0);
+    int server = accept4(listener, NULL, NULL, SOCK_CLOEXEC);
+    test_require(server >= 0);
+
+    char buffer[1000] = {0};
+    for (int i = 0; i != 10; i++) {
+        test_require(send(client, buffer, sizeof(buffer), 0) == sizeof(buffer));
+        if (i % 2 == 0) {
+            struct pollfd readable = {server, POLLIN, 0};
+            test_require(poll(&readable, 1, 1000) == 1);
+        }
+        else {
+            fd_set readable;
+            FD_ZERO(&readable);
+            FD_SET(server, &readable);
+            struct timeval timeout = {1, 0};
+            test_require(select(server + 1, &readable, NULL, NULL, &timeout) == 1);
+        }
+        test_require(recv(server, buffer, sizeof(buffer), MSG_WAITALL) == sizeof(buffer));
+    }
+    close(server), close(client), close(listener);
+}
+
+int test_loopback_check(char const *report) {
+    return test_report_has(report, "busiest sockets:", "10 000 bytes in 10 sends", "1 sockets opened") &&
+           test_report_has(report, "busiest sockets:", "10 000 bytes in 10 receives", "1 sockets opened") &&
+           test_report_has(report, "socket bytes per sent message:", "[512, 1 023]", " 10") &&
+           test_report_has(report, "poll and select ready descriptors per wakeup:", "[1, 1]", " 10");
+}
+
+#pragma endregion Sockets
+
+#pragma region Patterns
+
+/**
+ *  @brief  Matches a compiled expression against a range of a longer buffer with `REG_STARTEND`,
+ *          that only scans the given range, and replaces it with the position of the match.
+ */
+void test_regex_run(void) {
+    regex_t regex;
+    test_require(regcomp(&regex, "needle", 0) == 0);
+    char haystack[200];
+    memset(haystack, 'x', sizeof(haystack));
+    memcpy(haystack + 10, "needle", 6);
+    for (int i = 0; i != 10; i++) {
+        regmatch_t match = {0, 100};
+        test_require(regexec(&regex, haystack, 1, &match, REG_STARTEND) == 0);
+        test_require(match.rm_so == 10 && match.rm_eo == 16);
+    }
+    regfree(&regex);
+}
+
+int test_regex_check(char const *report) {
+    return test_report_has(report, "most expensive patterns:", "regcomp \"needle\"", "over 1 000 bytes, 10 hits");
+}
+
+#if LIBSEE_TEST_PCRE2
+
+/**
+ *  @brief  Matches a PCRE2 pattern with a reused match data block, and then allocating a new block
+ *          for every match, which the report should flag as churn.
+ */
+void test_pcre2_run(void) {
+    int error_code;
+    PCRE2_SIZE error_offset;
+    pcre2_code *code = pcre2_compile((PCRE2_SPTR) "a+b", PCRE2_ZERO_TERMINATED, 0, &error_code, &error_offset, NULL);
+    test_require(code != NULL);
+    pcre2_jit_compile(code, PCRE2_JIT_COMPLETE); // The JIT may be unavailable, and the matches still work
+
+    char subject[1000];
+    memset(subject, 'x', sizeof(subject));
+    memcpy(subject + sizeof(subject) - 3, "aab", 3);
+    pcre2_match_data *reused = pcre2_match_data_create_from_pattern(code, NULL);
+    for (int i = 0; i != 100; i++)
+        test_require(pcre2_match(code, (PCRE2_SPTR)subject, sizeof(subject), 0, 0, reused, NULL) == 1);
+    pcre2_match_data_free(reused);
+    for (int i = 0; i != 10; i++) {
+        pcre2_match_data *temporary = pcre2_match_data_create(4, NULL);
+        test_require(pcre2_match(code, (PCRE2_SPTR)subject, sizeof(subject), 0, 0, temporary, NULL) == 1);
+        pcre2_match_data_free(temporary);
+    }
+    pcre2_code_free(code);
+}
+
+int test_pcre2_check(char const *report) {
+    return test_report_has(report, "most expensive patterns:", "pcre2_compile_8 \"a+b\"", "1 compiles") &&
+           test_report_has(report, "most expensive patterns:", "110 calls", "over 110 000 bytes, 110 hits") &&
+           test_report_has(report, "PCRE2 match data:", "blocks created,", " 11") &&
+           test_report_has(report, "PCRE2 match data:", "blocks released,", " 11") &&
+           test_report_has(report, "PCRE2 match data:", "matches,", " 110");
+}
+
+#endif // LIBSEE_TEST_PCRE2
+
+#pragma endregion Patterns
+
+#pragma region Algorithms
+
+int test_compare_integers(void const *a, void const *b) {
+    int const x = *(int const *)a, y = *(int const *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ *  @brief  Sorts the same array of integers over and over, so that every sampled call sees it already sorted.
+ */
+void test_qsort_run(void) {
+    int numbers[100];
+    for (int i = 0; i != 100; i++) numbers[i] = (i * 37) % 100;
+    for (int i = 0; i != 32; i++) qsort(numbers, 100, sizeof(int), test_compare_integers);
+    test_require(numbers[0] == 0 && numbers[99] == 99);
+}
+
+int test_qsort_check(char const *report) {
+    // The first call is sampled before sorting the shuffled array, and the seventeenth on the sorted one
+    char const *sampling = "qsort presortedness, sampling 1 in 16 calls";
+    return test_report_has(report, "qsort element sizes, bytes:", "[4, 7]", " 32") &&
+           test_report_has(report, "qsort element counts:", "[64, 127]", " 32") &&
+           test_report_has(report, sampling, "sampled calls,", " 2") &&
+           test_report_has(report, sampling, "already sorted,", " 1");
+}
+
+/**
+ *  @brief  Fills a hash table, entering the same key repeatedly, builds a small tree, and scans an array linearly.
+ */
+void test_search_run(void) {
+    static char keys[60][8], repeated[] = "repeated";
+    test_require(hcreate(100));
+    for (int i = 0; i != 60; i++) {
+        snprintf(keys[i], sizeof(keys[i]), "key%d", i);
+        ENTRY item = {keys[i], NULL};
+        test_require(hsearch(item, ENTER));
+    }
+    ENTRY item = {repeated, repeated};
+    for (int i = 0; i != 50; i++) test_require(hsearch(item, ENTER));
+    hdestroy();
+
+    static int numbers[16];
+    void *root = NULL;
+    for (int i = 0; i != 16; i++) numbers[i] = i;
+    for (int i = 0; i != 16; i++) test_require(tsearch(&numbers[i], &root, test_compare_integers));
+    for (int i = 0; i != 16; i++) test_require(tfind(&numbers[i], &root, test_compare_integers));
+
+    size_t count = 16;
+    int const last = 15;
+    for (int i = 0; i != 5; i++) test_require(lfind(&last, numbers, &count, sizeof(int), test_compare_integers));
+}
+
+int test_search_check(char const *report) {
+    // Re-entering an existing key must not count towards the load
+    return test_report_has(report, "hash tables:", "peak load factor,", " 0.610") &&
+           test_report_has(report, "lsearch and lfind comparisons per call:", "[16, 31]", " 5") &&
+           test_report_has(report, "tsearch, tfind, and tdelete comparisons per call:", "[", NULL) &&
+           test_report_has(report, NULL, "tsearch,", " 16, ") && test_report_has(report, NULL, "tfind,", " 16, ");
+}
+
+#pragma endregion Algorithms
+
+#pragma region Math
+
+/**
+ *  @brief  Evaluates the sine on every class of floating-point inputs, including the denormals and the huge
+ *          arguments, that take the slow paths, and the exponent on small inputs only.
+ */
+void test_math_run(void) {
+    double const inputs[] = {0.0, 5e-320, NAN, INFINITY, 0.75, 3.0, 1e300};
+    double sum = 0;
+    for (int i = 0; i != 10; i++)
+        for (size_t j = 0; j != sizeof(inputs) / sizeof(inputs[0]); j++) {
+            double result = sin(inputs[j]);
+            if (isfinite(result)) sum += result;
+        }
+    for (int i = 0; i != 20; i++) sum += exp(0.75);
+    test_require(isfinite(sum) && sum > 0);
+}
+
+int test_math_check(char const *report) {
+    return test_report_has(report, NULL, "sin,", " 70, ") && test_report_has(report, NULL, "exp,", " 20, ") &&
+           test_report_has(report, "sin arguments:", "zeros,", " 10") &&
+           test_report_has(report, "sin arguments:", "denormals,", " 10") &&
+           test_report_has(report, "sin arguments:", "NaNs,", " 10") &&
+           test_report_has(report, "sin arguments:", "infinities,", " 10") &&
+           test_report_has(report, "sin arguments:", "[2^-1, 2^0),", " 10") &&
+           test_report_has(report, "sin arguments:", "[2^1, 2^2),", " 10") &&
+           test_report_has(report, "sin arguments:", "[2^", ", inf),") &&
+           test_report_has(report, "exp arguments:", "[2^-1, 2^0),", " 20");
+}
+
+#pragma endregion Math
+
+#pragma region Numeric Parsing
+
+/**
+ *  @brief  Parses integers and floats from the prefixes of longer strings, and passes an invalid base once,
+ *          which must leave the end pointer untouched and count no parsed bytes.
+ */
+void test_parsing_run(void) {
+    long sum = 0;
+    char *end = NULL;
+    for (int i = 0; i != 10; i++) {
+        sum += strtol("12345 and the rest", &end, 10);
+        test_require(end && *end == ' ');
+    }
+    for (int i = 0; i != 4; i++) sum += (long)strtod("2.5e3 and the rest", NULL);
+    // With optimizations, glibc headers inline `atoi` into `strtol`, unless it's called through a pointer
+    int (*volatile parse_integer)(char const *) = atoi;
+    for (int i = 0; i != 5; i++) sum += parse_integer("678 and the rest");
+    char *untouched = (char *)"sentinel";
+    end = untouched;
+    test_require(strtol("123", &end, 1) == 0 && end == untouched);
+    test_require(sum == 10 * 12345 + 4 * 2500 + 5 * 678);
+}
+
+int test_parsing_check(char const *report) {
+    return test_report_has(report, NULL, "strtol,", " 11, ") && test_report_has(report, NULL, "strtol,", " 50, ") &&
+           test_report_has(report, NULL, "strtod,", " 4, ") && test_report_has(report, NULL, "strtod,", " 20, ") &&
+           test_report_has(report, NULL, "atoi,", " 5, ") && test_report_has(report, NULL, "atoi,", " 15, ");
+}
+
+#pragma endregion Numeric Parsing
+
+#pragma region Wide Characters
+
+/**
+ *  @brief  Converts a string between the multibyte and wide forms in the default "C" locale,
+ *          whose ASCII codeset misses the UTF-8 fast paths, both in bulk and a character at a time.
+ */
+void test_multibyte_run(void) {
+    char const *narrow = "sixteen bytes...";
+    wchar_t wide[32];
+    char restored[32];
+    for (int i = 0; i != 10; i++) {
+        test_require(mbstowcs(wide, narrow, 32) == 16);
+        test_require(wcstombs(restored, wide, sizeof(restored)) == 16 && strcmp(restored, narrow) == 0);
+    }
+    mbstate_t state;
+    memset(&state, 0, sizeof(state));
+    for (char const *it = narrow; *it; it++) test_require(mbrtowc(wide, it, 1, &state) == 1);
+}
+
+int test_multibyte_check(char const *report) {
+    char const *non_utf8 = "multibyte conversions under non-UTF-8 locales:";
+    return test_report_has(report, NULL, "mbstowcs,", " 160, ") &&
+           test_report_has(report, NULL, "wcstombs,", " 160, ") && test_report_has(report, NULL, "mbrtowc,", " 16, ") &&
+           test_report_has(report, non_utf8, "mbstowcs,", " 10") &&
+           test_report_has(report, non_utf8, "wcstombs,", " 10") &&
+           test_report_has(report, non_utf8, "mbrtowc,", " 16");
+}
+
+/**
+ *  @brief  Compares, copies, searches, and tokenizes wide strings, that only scan a part of their inputs.
+ */
+void test_wide_strings_run(void) {
+    wchar_t const *text = L"hello world";
+    wchar_t copy[32], *context = NULL;
+    for (int i = 0; i != 10; i++) {
+        test_require(wcslen(text) == 11 && wcscmp(text, L"hello there") > 0);
+        test_require(wcschr(text, L'w') == text + 6 && wcsstr(text, L"wor") == text + 6);
+        test_require(wcscpy(copy, text) == copy);
+        size_t tokens = 0;
+        for (wchar_t *token = wcstok(copy, L" ", &context); token; token = wcstok(NULL, L" ", &context)) tokens++;
+        test_require(tokens == 2);
+    }
+}
+
+int test_wide_strings_check(char const *report) {
+    // Characters are counted up to the mismatch, the match, or the terminator, four bytes each
+    return test_report_has(report, NULL, "wcslen,", " 440, ") && test_report_has(report, NULL, "wcscmp,", " 280, ") &&
+           test_report_has(report, NULL, "wcschr,", " 280, ") && test_report_has(report, NULL, "wcsstr,", " 360, ") &&
+           test_report_has(report, NULL, "wcscpy,", " 480, ") && test_report_has(report, NULL, "wcstok,", " 440, ");
+}
+
+#pragma endregion Wide Characters
+
+#pragma region Localization
+
+/**
+ *  @brief  Queries the global locale in a tight loop, like the libraries formatting every number do,
+ *          which serializes the threads on the lock of `setlocale`, but calls `localeconv` rarely.
+ */
+void test_locale_run(void) {
+    for (int i = 0; i != 2000; i++) test_require(setlocale(LC_ALL, NULL));
+    for (int i = 0; i != 10; i++) test_require(localeconv()->decimal_point[0] == '.');
+}
+
+int test_locale_check(char const *report) {
+    return test_report_has(report, NULL, "scaling hazard: setlocale", "called 2 000 times within a second") &&
+           !test_report_has(report, NULL, "scaling hazard: localeconv", NULL) &&
+           test_report_has(report, "most expensive call sites:", "setlocale,", " 2 000 calls") &&
+           test_report_has(report, "most expensive call sites:", "localeconv,", " 10 calls");
+}
+
+#pragma endregion Localization
+
+#pragma region Input and Output
+
+/**
+ *  @brief  Writes wide lines and characters to a temporary file, and reads them back a character at a time.
+ */
+void test_wide_stdio_run(void) {
+    FILE *file = tmpfile();
+    test_require(file);
+    for (int i = 0; i != 10; i++) test_require(fputws(L"wide line\n", file) >= 0);
+    for (int i = 0; i != 10; i++) test_require(fputwc(L'x', file) == L'x');
+    rewind(file);
+    size_t characters = 0;
+    while (fgetwc(file) != WEOF) characters++;
+    test_require(characters == 110);
+    fclose(file);
+}
+
+int test_wide_stdio_check(char const *report) {
+    // The fields are the average characters and bytes per call, and the last `fgetwc` call reads nothing
+    char const *wide = "wide stdio characters and bytes per call:";
+    return test_report_has(report, wide, "fputws,", " 10.00,") && test_report_has(report, wide, "fputwc,", " 1.00,") &&
+           test_report_has(report, NULL, "fgetwc,", " 111, ") && test_report_has(report, NULL, "fgetwc,", " 110, ");
+}
+
+/**
+ *  @brief  Writes a temporary file a character at a time, first with the locking functions,
+ *          and then with their `_unlocked` variants under a single `flockfile`.
+ */
+void test_character_stdio_run(void) {
+    // With optimizations, glibc headers inline the `_unlocked` functions, unless they are called through a pointer
+    int (*volatile put_unlocked)(int, FILE *) = fputc_unlocked;
+    FILE *file = tmpfile();
+    test_require(file);
+    for (int i = 0; i != 100; i++) test_require(fputc('a', file) == 'a');
+    flockfile(file);
+    for (int i = 0; i != 200; i++) test_require(put_unlocked('b', file) == 'b');
+    funlockfile(file);
+    fclose(file);
+}
+
+int test_character_stdio_check(char const *report) {
+    char const *streams = "character I/O per stream:";
+    return test_report_has(report, streams, "locked: ", " over 100 bytes, unlocked: ") &&
+           test_report_has(report, streams, "unlocked: ", " over 200 bytes") &&
+           test_report_has(report, NULL, "fputc_unlocked,", " 200, ");
+}
+
+/**
+ *  @brief  Writes the same blocks to an unbuffered stream, that issues a system call for each of them,
+ *          and to a fully-buffered one, that only flushes when its buffer is full.
+ */
+void test_buffering_run(void) {
+    char block[100] = {0};
+    FILE *unbuffered = tmpfile(), *buffered = tmpfile();
+    test_require(unbuffered && buffered && setvbuf(unbuffered, NULL, _IONBF, 0) == 0);
+    for (int i = 0; i != 10; i++) {
+        test_require(fwrite(block, 1, sizeof(block), unbuffered) == sizeof(block));
+        test_require(fwrite(block, 1, sizeof(block), buffered) == sizeof(block));
+    }
+    fclose(unbuffered), fclose(buffered);
+}
+
+int test_buffering_check(char const *report) {
+    // The default buffer size follows the block size of the file system, so it isn't checked
+    char const *buffering = "stream buffering:";
+    return test_report_has(report, buffering, "unbuffered, 1 bytes (setvbuf), 0.00% of 10 calls buffered",
+               ", 100 bytes per refilling or flushing call") &&
+           test_report_has(report, buffering, "fully-buffered,", "(default), 100.00% of 10 calls buffered");
+}
+
+/**
+ *  @brief  Writes and reads back several numbered files, that differ only in their digits, so that their costs
+ *          are attributed to a single path pattern, and seeks within one of them.
+ */
+void test_paths_run(void) {
+    char path[64], block[32] = {0};
+    for (int i = 0; i != 3; i++) {
+        snprintf(path, sizeof(path), "/tmp/libsee_test_%d_%d.txt", (int)getpid(), i);
+        FILE *file = fopen(path, "w+");
+        test_require(file && fwrite(block, 1, sizeof(block), file) == sizeof(block));
+        test_require(fseek(file, 0, SEEK_SET) == 0 && fread(block, 1, sizeof(block), file) == sizeof(block));
+        test_require(fclose(file) == 0 && unlink(path) == 0);
+    }
+}
+
+int test_paths_check(char const *report) {
+    // Every file is opened, written, sought, read, and closed
+    return test_report_has(
+        report, "most expensive files:", "/tmp/libsee_test_#_#.txt,", " 15 calls, 192 bytes, 3 seeks");
+}
+
+/**
+ *  @brief  Reads fixed-size blocks from a file, that is named after the pattern, at the given offsets.
+ */
+void test_access_pattern_read(char const *pattern, long const *offsets, size_t count) {
+    char path[64], block[100] = {0};
+    snprintf(path, sizeof(path), "/tmp/libsee_test_%s_%d", pattern, (int)getpid());
+    FILE *file = fopen(path, "w+");
+    test_require(file);
+    for (int i = 0; i != 100; i++) test_require(fwrite(block, 1, sizeof(block), file) == sizeof(block));
+    for (size_t i = 0; i != count; i++) {
+        test_require(fseek(file, offsets[i], SEEK_SET) == 0);
+        test_require(fread(block, 1, sizeof(block), file) == sizeof(block));
+    }
+    test_require(fclose(file) == 0 && unlink(path) == 0);
+}
+
+/**
+ *  @brief  Reads one file front to back, another one skipping the same distance between the reads,
+ *          and the last one at scattered offsets.
+ */
+void test_access_patterns_run(void) {
+    long const sequential[] = {0, 100, 200, 300, 400, 500, 600, 700};
+    long const strided[] = {0, 1000, 2000, 3000, 4000, 5000, 6000, 7000};
+    long const scattered[] = {7000, 300, 5100, 900, 2500, 6600, 1200, 4400};
+    test_access_pattern_read("sequential", sequential, 8);
+    test_access_pattern_read("strided", strided, 8);
+    test_access_pattern_read("scattered", scattered, 8);
+}
+
+int test_access_patterns_check(char const *report) {
+    // The first read of every file starts at the beginning, and is classified as sequential
+    char const *patterns = "file access patterns:";
+    return test_report_has(report, patterns, "sequential_#,", "8 reads: 100.00% sequential, 0.00% strided") &&
+           test_report_has(report, patterns, "strided_#,", "8 reads: 12.50% sequential, 75.00% strided") &&
+           test_report_has(report, patterns, "scattered_#,", "8 reads: 12.50% sequential, 0.00% strided") &&
+           test_report_has(report, patterns, "mostly strided:", NULL) &&
+           test_report_has(report, patterns, "mostly random:", NULL);
+}
+
+#pragma endregion Input and Output
+
+#pragma region Processes
+
+extern char **environ;
+
+/**
+ *  @brief  Starts children with `fork`, `posix_spawn`, and `popen`, and waits for all of them.
+ */
+void test_processes_run(void) {
+    // The children must not print reports of their own into the same pipe
+    test_require(unsetenv("LD_PRELOAD") == 0);
+    int status = 0;
+    for (int i = 0; i != 3; i++) {
+        pid_t child = fork();
+        test_require(child >= 0);
+        if (child == 0) _exit(0);
+        test_require(waitpid(child, &status, 0) == child && WIFEXITED(status));
+    }
+    char *const arguments[] = {"true", NULL};
+    for (int i = 0; i != 2; i++) {
+        pid_t child = 0;
+        test_require(posix_spawn(&child, "/bin/true", NULL, NULL, arguments, environ) == 0);
+        test_require(waitpid(child, &status, 0) == child && WIFEXITED(status));
+    }
+    FILE *pipe = popen("true", "r");
+    test_require(pipe && pclose(pipe) == 0);
+}
+
+int test_processes_check(char const *report) {
+    char const *sites = "process creation call sites:";
+    return test_report_has(report, sites, "fork,", " 3 calls") &&
+           test_report_has(report, sites, "posix_spawn,", " 2 calls") &&
+           test_report_has(report, sites, "popen,", " 1 calls") &&
+           test_report_has(report, "parent resident bytes at fork:", "[", " 3") &&
+           test_report_has(report, NULL, "largest parent at fork, bytes,", NULL);
+}
+
+#pragma endregion Processes
+
+#pragma region Clocks
+
+/**
+ *  @brief  Reads a clock, that the vDSO serves, and one, that always takes a system call, and sleeps briefly.
+ */
+void test_clocks_run(void) {
+    struct timespec now, nap = {0, 1000000};
+    for (int i = 0; i != 100; i++) test_require(clock_gettime(CLOCK_MONOTONIC, &now) == 0);
+    for (int i = 0; i != 10; i++) test_require(clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now) == 0);
+    for (int i = 0; i != 3; i++) test_require(nanosleep(&nap, NULL) == 0);
+}
+
+int test_clocks_check(char const *report) {
+    // The overshoots depend on the scheduler, so only their presence is checked
+    char const *clocks = "clock_gettime per clock:";
+    return test_report_has(report, clocks, "CLOCK_MONOTONIC,", " 100 calls, ") &&
+           test_report_has(report, clocks, "CLOCK_PROCESS_CPUTIME_ID,", " 10 calls, ") &&
+           test_report_has(report, clocks, "CLOCK_PROCESS_CPUTIME_ID,", ", always a system call") &&
+           test_report_has(report, "sleep overshoot, nanoseconds:", "[", NULL);
+}
+
+#pragma endregion Clocks
+
+#pragma region Random Numbers
+
+void *test_random_thread(void *seed) {
+    unsigned state = (unsigned)(size_t)seed;
+    for (int i = 0; i != 100; i++) rand(), rand_r(&state);
+    return NULL;
+}
+
+/**
+ *  @brief  Draws numbers from the generator with a global state on several threads, and from the re-entrant one
+ *          with a state per thread, and draws from the `drand48` family on the main thread only.
+ */
+void test_random_run(void) {
+    pthread_t threads[4];
+    for (size_t i = 0; i != 4; i++)
+        test_require(pthread_create(&threads[i], NULL, test_random_thread, (void *)(i + 1)) == 0);
+    for (size_t i = 0; i != 4; i++) test_require(pthread_join(threads[i], NULL) == 0);
+    for (int i = 0; i != 10; i++) test_require(drand48() < 1);
+}
+
+int test_random_check(char const *report) {
+    return test_report_has(report, NULL, "scaling hazard: rand takes", "from 4 threads, 400 calls in total") &&
+           !test_report_has(report, NULL, "scaling hazard: drand48", NULL) &&
+           !test_report_has(report, NULL, "scaling hazard: rand_r", NULL) &&
+           test_report_has(report, NULL, "rand_r,", " 400, ");
+}
+
+#pragma endregion Random Numbers
+
+#pragma region Filesystem
+
+/**
+ *  @brief  Checks the same files over and over, like the programs probing their configuration on every request,
+ *          and lists a directory once.
+ */
+void test_metadata_run(void) {
+    struct stat info;
+    for (int i = 0; i != 10; i++) test_require(stat("/etc/passwd", &info) == 0);
+    for (int i = 0; i != 5; i++) test_require(access("/etc/passwd", R_OK) == 0);
+    DIR *directory = opendir("/proc/self");
+    test_require(directory);
+    size_t entries = 0;
+    while (readdir(directory)) entries++;
+    test_require(entries > 2 && closedir(directory) == 0);
+}
+
+int test_metadata_check(char const *report) {
+    char const *prefixes = "filesystem metadata by path prefix:";
+    return test_report_has(report, prefixes, "/etc/,", " 15 calls, ") &&
+           test_report_has(report, prefixes, "/etc/,", "14 of 15 stats repeated within 100 ms") &&
+           test_report_has(report, prefixes, "/proc/,", " 1 calls, ") &&
+           test_report_has(report, NULL, "stat,", " 10, ") && test_report_has(report, NULL, "access,", " 5, ");
+}
+
+#pragma endregion Filesystem
+
+#pragma region Environment
+
+/**
+ *  @brief  Looks up a set and an unset variable in loops, updating the first one in between.
+ */
+void test_environment_run(void) {
+    for (int i = 0; i != 10; i++) {
+        test_require(setenv("LIBSEE_TEST_SET", i % 2 ? "odd" : "even", 1) == 0);
+        for (int j = 0; j != 10; j++) test_require(getenv("LIBSEE_TEST_SET"));
+    }
+    for (int i = 0; i != 5; i++) test_require(!getenv("LIBSEE_TEST_UNSET"));
+}
+
+int test_environment_check(char const *report) {
+    char const *sites = "environment lookup call sites", *variables = "environment variables";
+    return test_report_has(report, sites, "LIBSEE_TEST_SET,", " 100 calls") &&
+           test_report_has(report, sites, "LIBSEE_TEST_UNSET,", " 5 calls") &&
+           test_report_has(report, variables, "LIBSEE_TEST_SET,", " 100 lookups, 0 unset, 10 updates") &&
+           test_report_has(report, variables, "LIBSEE_TEST_UNSET,", " 5 lookups, 5 unset, 0 updates");
+}
+
+#pragma endregion Environment
+
+#pragma region Name Resolution
+
+/**
+ *  @brief  Resolves "localhost" from `/etc/hosts` repeatedly, and two numeric-only names, too long to be stored
+ *          whole, that only differ after the stored prefix.
+ */
+void test_resolver_run(void) {
+    struct addrinfo hints, *results = NULL;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET, hints.ai_socktype = SOCK_STREAM;
+    for (int i = 0; i != 5; i++) {
+        test_require(getaddrinfo("localhost", NULL, &hints, &results) == 0 && results);
+        freeaddrinfo(results);
+    }
+    for (int i = 0; i != 3; i++) test_require(gethostbyname("localhost"));
+
+    char long_name[100];
+    memset(long_name, 'a', sizeof(long_name));
+    long_name[sizeof(long_name) - 1] = 0;
+    hints.ai_flags = AI_NUMERICHOST;
+    for (int i = 0; i != 4; i++) {
+        long_name[sizeof(long_name) - 2] = i % 2 ? 'b' : 'c';
+        test_require(getaddrinfo(long_name, NULL, &hints, &results) != 0);
+    }
+}
+
+int test_resolver_check(char const *report) {
+    // The long names must land in two slots, both marked as truncated
+    char const *lookups = "slowest name lookups";
+    return test_report_has(report, lookups, "getaddrinfo localhost,", " 5 calls, 4 repeated, 0 failed, 1 threads") &&
+           test_report_has(report, lookups, "gethostbyname localhost,", " 3 calls, 2 repeated, 0 failed") &&
+           test_report_count(report, lookups, "aaa...,", " 2 calls, 1 repeated, 2 failed") == 2 &&
+           test_report_has(report, NULL, "getaddrinfo,", " 9, ");
+}
+
+#pragma endregion Name Resolution
+
+#pragma region Dynamic Loading
+
+/**
+ *  @brief  Opens and closes a library repeatedly with `RTLD_LOCAL`, checking that the lookups keep the semantics
+ *          of the loader, which resolves them relative to the caller, and not to LibSee.
+ */
+void test_dlopen_run(void) {
+    for (int i = 0; i != 3; i++) {
+        void *handle = dlopen("libz.so.1", RTLD_NOW | RTLD_LOCAL);
+        test_require(handle && dlsym(handle, "zlibVersion"));
+        test_require(!dlsym(RTLD_DEFAULT, "zlibVersion") && dlsym(RTLD_NEXT, "dlopen"));
+        test_require(dlclose(handle) == 0);
+    }
+}
+
+int test_dlopen_check(char const *report) {
+    char const *libraries = "slowest libraries to load";
+    return test_report_has(report, libraries, "libz.so.1,", "3 opens, 3 closes, closed and reopened") &&
+           !test_report_has(report, NULL, "dlsym", NULL) && test_report_has(report, "startup", "before main,", NULL);
+}
+
+#pragma endregion Dynamic Loading
+
+#if LIBSEE_TEST_BLAS
+#pragma region BLAS
+
+/*
+ *  Only the few used entry points are declared, as the CBLAS headers differ between the implementations.
+ *  The enumerations are passed as integers, using the values from the CBLAS specification.
+ */
+void cblas_dgemm(int layout, int transpose_a, int transpose_b, int m, int n, int k, double alpha, double const *a,
+    int lda, double const *b, int ldb, double beta, double *c, int ldc);
+void dgemm_(char const *transpose_a, char const *transpose_b, int const *m, int const *n, int const *k,
+    double const *alpha, double const *a, int const *lda, double const *b, int const *ldb, double const *beta,
+    double *c, int const *ldc);
+void daxpy_(int const *n, double const *alpha, double const *x, int const *incx, double *y, int const *incy);
+void dpotrf_(char const *uplo, int const *n, double *a, int const *lda, int *info, size_t uplo_length);
+void dsyev_(char const *jobz, char const *uplo, int const *n, double *a, int const *lda, double *w, double *work,
+    int const *lwork, int *info, size_t jobz_length, size_t uplo_length);
+void dgesdd_(char const *jobz, int const *m, int const *n, double *a, int const *lda, double *s, double *u,
+    int const *ldu, double *vt, int const *ldvt, double *work, int const *lwork, int *iwork, int *info,
+    size_t jobz_length);
+
+enum { test_cblas_row_major = 101, test_cblas_no_trans = 111 };
+
+/**
+ *  @brief  Multiplies many tiny matrices through CBLAS and a few larger ones through the Fortran interface,
+ *          and adds up vectors, each landing in its own shape class.
+ */
+void test_blas_run(void) {
+    static double a[64 * 64], b[64 * 64], c[64 * 64], x[1000], y[1000];
+    for (int i = 0; i != 64 * 64; i++) a[i] = b[i] = 1.0 / (i + 1);
+    for (int i = 0; i != 1000; i++) x[i] = y[i] = i;
+    for (int i = 0; i != 100; i++)
+        cblas_dgemm(test_cblas_row_major, test_cblas_no_trans, test_cblas_no_trans, 8, 8, 8, 1, a, 8, b, 8, 0, c, 8);
+    int const size = 64, length = 1000, stride = 1;
+    double const one = 1, zero = 0;
+    for (int i = 0; i != 10; i++) dgemm_("N", "N", &size, &size, &size, &one, a, &size, b, &size, &zero, c, &size);
+    for (int i = 0; i != 10; i++) daxpy_(&length, &one, x, &stride, y, &stride);
+    test_require(c[0] > 0 && y[1] == 11);
+}
+
+int test_blas_check(char const *report) {
+    return test_report_has(report, NULL, "cblas_dgemm,", " 100, ") &&
+           test_report_has(report, NULL, "dgemm_,", " 10, ") && test_report_has(report, NULL, "daxpy_,", " 10, ") &&
+           test_report_has(report, "BLAS and LAPACK shapes", "dgemm up to 8x8x8,", " 100 calls") &&
+           test_report_has(report, "BLAS and LAPACK shapes", "dgemm up to 64x64x64,", " 10 calls") &&
+           test_report_has(report, "BLAS and LAPACK shapes", "daxpy up to 1024,", " 10 calls");
+}
+
+/**
+ *  @brief  Factors and decomposes small symmetric positive definite matrices, querying the workspace size
+ *          before every decomposition, like most solver loops do.
+ */
+void test_lapack_run(void) {
+    enum { size = 16 };
+    static double a[size * size], values[size], u[size * size], vt[size * size], work[4096];
+    static int iwork[8 * size];
+    int const n = size, query = -1, capacity = 4096;
+    int info = 0;
+    for (int round = 0; round != 10; round++) {
+        for (int i = 0; i != size * size; i++) a[i] = (i / size == i % size) ? size : 1.0 / (1 + i / size + i % size);
+        dpotrf_("U", &n, a, &n, &info, 1);
+        test_require(info == 0);
+
+        for (int i = 0; i != size * size; i++) a[i] = (i / size == i % size) ? size : 1;
+        dsyev_("V", "U", &n, a, &n, values, work, &query, &info, 1, 1);
+        test_require(info == 0 && work[0] <= capacity);
+        dsyev_("V", "U", &n, a, &n, values, work, &capacity, &info, 1, 1);
+        test_require(info == 0 && values[size - 1] > values[0]);
+
+        for (int i = 0; i != size * size; i++) a[i] = (i / size == i % size) ? size : 1;
+        dgesdd_("A", &n, &n, a, &n, values, u, &n, vt, &n, work, &query, iwork, &info, 1);
+        test_require(info == 0 && work[0] <= capacity);
+        dgesdd_("A", &n, &n, a, &n, values, u, &n, vt, &n, work, &capacity, iwork, &info, 1);
+        test_require(info == 0 && values[0] >= values[size - 1]);
+    }
+}
+
+int test_lapack_check(char const *report) {
+    char const *shapes = "BLAS and LAPACK shapes", *queries = "LAPACK workspace queries";
+    return test_report_has(report, NULL, "dpotrf_,", " 10, ") && test_report_has(report, NULL, "dsyev_,", " 20, ") &&
+           test_report_has(report, NULL, "dgesdd_,", " 20, ") &&
+           test_report_has(report, shapes, "dpotrf up to 16x16,", " 10 calls") &&
+           test_report_has(report, shapes, "dsyev up to 16x16,", " 10 calls") &&
+           test_report_has(report, shapes, "dgesdd up to 16x16,", " 10 calls") &&
+           !test_report_has(report, shapes, "dgemm", NULL) &&
+           test_report_has(report, queries, "dsyev 16x16 jobz=V,", " 10 queries") &&
+           test_report_has(report, queries, "dgesdd 16x16 jobz=A,", " 10 queries");
+}
+
+#pragma endregion BLAS
+#endif // LIBSEE_TEST_BLAS
+
+#if LIBSEE_TEST_ZLIB
+#pragma region zlib
+
+/**
+ *  @brief  Opens zlib only after the start, then compresses and decompresses buffers in one shot,
+ *          which runs `deflate` and `inflate` internally, and through short-lived streams.
+ */
+void test_zlib_run(void) {
+    test_require(!dlopen("libz.so.1", RTLD_NOW | RTLD_NOLOAD));
+    test_require(compress2 && dlopen("libz.so.1", RTLD_NOW | RTLD_LOCAL));
+
+    static unsigned char original[64 * 1024], compressed[80 * 1024], restored[64 * 1024];
+    for (size_t i = 0; i != sizeof(original); i++) original[i] = (unsigned char)"the quick brown fox "[i % 20];
+    for (int i = 0; i != 10; i++) {
+        unsigned long compressed_length = sizeof(compressed), restored_length = sizeof(restored);
+        test_require(compress2(compressed, &compressed_length, original, sizeof(original), 6) == Z_OK);
+        test_require(uncompress(restored, &restored_length, compressed, compressed_length) == Z_OK);
+        test_require(restored_length == sizeof(original) && memcmp(restored, original, sizeof(original)) == 0);
+    }
+    for (int i = 0; i != 10; i++) {
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+        test_require(deflateInit(&stream, 6) == Z_OK);
+        stream.next_in = original, stream.avail_in = 4096;
+        stream.next_out = compressed, stream.avail_out = sizeof(compressed);
+        test_require(deflate(&stream, Z_FINISH) == Z_STREAM_END);
+        test_require(deflateEnd(&stream) == Z_OK);
+    }
+}
+
+int test_zlib_check(char const *report) {
+    char const *sites = "zlib call sites", *streams = "zlib streams";
+    return test_report_has(report, NULL, "compress2,", " 10, ") &&
+           test_report_has(report, NULL, "uncompress,", " 10, ") &&
+           test_report_has(report, NULL, "deflateInit_,", " 10, ") &&
+           test_report_has(report, NULL, "deflate,", " 10, ") &&
+           !test_report_has(report, NULL, "inflate,", NULL) &&
+           test_report_has(report, sites, "compress2,", " 10 calls") &&
+           test_report_has(report, sites, "compress2,", " 655 360 bytes") &&
+           test_report_has(report, sites, "deflate,", " 40 960 bytes") &&
+           test_report_has(report, streams, "deflate streams,", " 20") &&
+           test_report_has(report, streams, "inflate streams,", " 10");
+}
+
+#pragma endregion zlib
+#endif // LIBSEE_TEST_ZLIB
+
+typedef struct test_scenario {
+    char const *name;
+    char const *library; // Build of LibSee to preload
+    void (*run)(void);
+    int (*check)(char const *report);
+} test_scenario;
+
+static test_scenario const test_scenarios[] = {
+    {"socketpair", LIBSEE_LIBRARY_PATH, test_socketpair_run, test_socketpair_check},
+    {"loopback", LIBSEE_LIBRARY_PATH, test_loopback_run, test_loopback_check},
+    {"regex", LIBSEE_LIBRARY_PATH, test_regex_run, test_regex_check},
+    {"environment", LIBSEE_LIBRARY_PATH, test_environment_run, test_environment_check},
+    {"resolver", LIBSEE_LIBRARY_PATH, test_resolver_run, test_resolver_check},
+    {"dlopen", LIBSEE_LIBRARY_PATH, test_dlopen_run, test_dlopen_check},
+    {"qsort", LIBSEE_LIBRARY_PATH, test_qsort_run, test_qsort_check},
+    {"search", LIBSEE_LIBRARY_PATH, test_search_run, test_search_check},
+    {"math", LIBSEE_LIBRARY_PATH, test_math_run, test_math_check},
+    {"parsing", LIBSEE_LIBRARY_PATH, test_parsing_run, test_parsing_check},
+    {"multibyte", LIBSEE_LIBRARY_PATH, test_multibyte_run, test_multibyte_check},
+    {"wide_strings", LIBSEE_LIBRARY_PATH, test_wide_strings_run, test_wide_strings_check},
+    {"wide_stdio", LIBSEE_LIBRARY_PATH, test_wide_stdio_run, test_wide_stdio_check},
+    {"locale", LIBSEE_LIBRARY_PATH, test_locale_run, test_locale_check},
+    {"character_stdio", LIBSEE_LIBRARY_PATH, test_character_stdio_run, test_character_stdio_check},
+    {"buffering", LIBSEE_LIBRARY_PATH, test_buffering_run, test_buffering_check},
+    {"paths", LIBSEE_LIBRARY_PATH, test_paths_run, test_paths_check},
+    {"access_patterns", LIBSEE_LIBRARY_PATH, test_access_patterns_run, test_access_patterns_check},
+    {"processes", LIBSEE_LIBRARY_PATH, test_processes_run, test_processes_check},
+    {"clocks", LIBSEE_LIBRARY_PATH, test_clocks_run, test_clocks_check},
+    {"random", LIBSEE_LIBRARY_PATH, test_random_run, test_random_check},
+    {"metadata", LIBSEE_LIBRARY_PATH, test_metadata_run, test_metadata_check},
+#if LIBSEE_TEST_BLAS
+    {"blas", LIBSEE_BLAS_LIBRARY_PATH, test_blas_run, test_blas_check},
+    {"lapack", LIBSEE_BLAS_LIBRARY_PATH, test_lapack_run, test_lapack_check},
+#endif
+#if LIBSEE_TEST_ZLIB
+    {"zlib", LIBSEE_ZLIB_LIBRARY_PATH, test_zlib_run, test_zlib_check},
+#endif
+#if LIBSEE_TEST_PCRE2
+    {"pcre2", LIBSEE_PCRE2_LIBRARY_PATH, test_pcre2_run, test_pcre2_check},
+#endif
+};
+
+static char test_report[LIBSEE_TEST_MAX_REPORT];
+
+/**
+ *  @brief  Runs the scenario in a child process with LibSee preloaded, collecting its report from the pipe.
+ *  @return Zero on success, or the failure reason.
+ */
+char const *test_scenario_run(test_scenario const *scenario) {
+    int output[2];
+    if (pipe(output) != 0) return "can't create a pipe";
+    pid_t child = fork();
+    if (child < 0) return "can't fork";
+    if (child == 0) {
+        dup2(output[1], STDOUT_FILENO);
+        close(output[0]), close(output[1]);
+        setenv("LD_PRELOAD", scenario->library, 1);
+        execl("/proc/self/exe", "libsee_test", scenario->name, (char *)NULL);
+        _exit(127);
+    }
+    close(output[1]);
+    size_t length = 0;
+    ssize_t chunk;
+    while ((chunk = read(output[0], test_report + length, LIBSEE_TEST_MAX_REPORT - 1 - length)) > 0)
+        length += (size_t)chunk;
+    close(output[0]);
+    test_report[length] = 0;
+
+    int status = 0;
+    if (waitpid(child, &status, 0) != child) return "can't wait for the child";
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) return "the scenario failed";
+    if (!strstr(test_report, "LIBSEE")) return "no report was printed";
+    if (!scenario->check(test_report)) return "the report is missing the expected statistics";
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    size_t const count = sizeof(test_scenarios) / sizeof(test_scenarios[0]);
+    if (argc > 1) {
+        for (size_t i = 0; i != count; i++)
+            if (strcmp(argv[1], test_scenarios[i].name) == 0) return test_scenarios[i].run(), 0;
+        fprintf(stderr, "unknown scenario: %s\n", argv[1]);
+        return 1;
+    }
+
+    size_t failures = 0;
+    for (size_t i = 0; i != count; i++) {
+        char const *failure = test_scenario_run(&test_scenarios[i]);
+        if (!failure) {
+            fprintf(stderr, "passed: %s\n", test_scenarios[i].name);
+            continue;
+        }
+        fprintf(stderr, "failed: %s, %s, the report was:\n%s\n", test_scenarios[i].name, failure, test_report);
+        failures++;
+    }
+    return failures ? 1 : 0;
+}